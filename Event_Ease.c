@@ -8,20 +8,181 @@
  * - Persistent data storage in text files
  */
 
+#if defined(__linux__) && !defined(_POSIX_C_SOURCE)
+// Under -std=c11 glibc and musl hide sigaction, mkstemp, fdopen, fileno and
+// nanosleep. The BSDs and macOS show them (and SIGWINCH) by default, and
+// asking them for strict POSIX would hide SIGWINCH, so they are left alone.
+#define _POSIX_C_SOURCE 200809L
+#endif
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <windows.h>
-#include <conio.h>
+#include <stdint.h>
+#include <stdarg.h>
 #include <time.h>  
 #include <ctype.h>
-
-
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <signal.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <conio.h>
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define EVENT_EASE_AVX2
+#define EVENT_EASE_SSE2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define EVENT_EASE_SSE2
+#endif
+
+
+#define EVENTS_FILE "events.txt"
 #define BOOKINGS_FILE "bookings.txt"
+#define EVENTS_BIN_FILE "events.bin"
+#define EVENT_INDEX_FILE "events.idx"
+#define BOOKINGS_BIN_FILE "bookings.bin"
 #define USER_INFO_FILE "user_info.txt"
 
 char loggedInUserName[100] = "";  // Stores currently logged-in user's name
 
+// One event as stored in events.txt: ID|Name|Venue|Date|Time|SeatCapacity
+typedef struct
+{
+    int id;  // Persistent; bookings refer to events by this ID
+    char name[100];
+    char venue[100];
+    char date[20];
+    char time[20];
+    int seatCapacity;
+} EventRecord;
+
+// Growable array of fixed-size elements
+typedef struct
+{
+    void *data;
+    int count;
+    int capacity;
+    size_t elemSize;
+} Vector;
+
+// A slice of a line read from a data file; not NUL-terminated
+typedef struct
+{
+    const char *ptr;
+    int len;
+} StrView;
+
+// A data file loaded whole (or mapped, see --mmap); nextRecordLine walks it line by line
+typedef struct
+{
+    char *data;
+    size_t size;
+    size_t pos;
+    int mapped;  // data is a read-only file mapping rather than a heap copy
+} RecordFile;
+
+// One row of the retained screen model (see TERMINAL BACKEND)
+typedef struct
+{
+    char *text;    // Bytes as written, color escape sequences included
+    int len;
+    int capacity;
+    int color;     // Color in effect where the row starts
+} ScreenLine;
+
+// A rewrite in progress: data goes to a unique temp file that replaces path on commit
+typedef struct
+{
+    FILE *file;
+    char path[260];
+    char tempPath[300];
+} AtomicFile;
+
+// One chunk of arena memory; blocks are chained newest-first
+typedef struct ArenaBlock
+{
+    struct ArenaBlock *next;
+    size_t size;
+    size_t used;
+    char data[];
+} ArenaBlock;
+
+// Bump allocator reset as a whole (see SCREEN ARENA)
+typedef struct
+{
+    ArenaBlock *head;
+    const char *label;
+    size_t bytesUsed;
+    int allocations;
+} Arena;
+
+// Accumulated arena usage for one screen
+typedef struct
+{
+    const char *label;
+    int visits;
+    size_t peakBytes;
+    size_t totalBytes;
+    int totalAllocations;
+} ScreenArenaStats;
+
+// Growable list of arena-allocated strings, laid out for printMenuItemsWithBoxes
+typedef struct
+{
+    const char **items;
+    int count;
+    int capacity;
+    Arena *arena;
+} StringList;
+
+// Lines shown left-aligned in one column that is centered as a whole (see printUnifiedBlock)
+typedef struct
+{
+    StringList lines;
+    int width;     // Widest line or reserved prompt, in visible columns
+    int column;    // Left edge, fixed when the block is printed
+} UnifiedBlock;
+
+// One registered user as stored in user_info.txt: TicketCode,Name
+// Ticket codes below 10000 are the original 4-digit codes; larger ones are
+// 40-bit codes written as 8 base32 characters (see formatTicketCode).
+typedef struct
+{
+    long long ticket;
+    char name[100];
+    int active;  // Cleared when the user is removed
+} UserRecord;
+
+// One booking replayed from the bookings.txt journal
+typedef struct
+{
+    int eventID;
+    char name[100];
+    int quantity;     // Seats held; journal entries use it for the seats added or cancelled
+    int active;       // Cleared when tombstones cancel every seat
+    int nextForUser;  // Next record of the same user (oldest first), or -1
+    int nextForEvent; // Next record of the same event (oldest first), or -1
+} BookingRecord;
+
+// One booking joined with the name of the event it refers to
+typedef struct
+{
+    int eventID;
+    char name[100];
+    int quantity;
+    const char *eventName;
+} BookingRow;
+
 /*
  * ========================= FUNCTION DECLARATIONS =========================
  */
@@ -31,12 +192,35 @@ void landingPage();
 void newUserRegistration();
 void existingUserLogin();
 void adminLogin();
-int generateUniqueTicketCode();
-int isTicketCodeExists(int ticketCode);
+long long generateUniqueTicketCode();
+int isTicketCodeExists(long long ticketCode);
 int isNameExists(const char *name);
 int equalsIgnoreCase(const char *a, const char *b);
-void saveUserInfo(int ticketCode, const char *name);
-int validateUserLogin(const char *name, int ticketCode);
+void saveUserInfo(long long ticketCode, const char *name);
+int validateUserLogin(const char *name, long long ticketCode);
+void formatTicketCode(long long ticketCode, char *out, size_t size);
+long long parseTicketCode(const char *text);
+long long parseTicketCodeView(StrView text);
+int parseUserLine(StrView line, long long *ticketCode, char *name, size_t nameSize);
+
+// Core: in-memory user index (hash lookups by ticket code and by name)
+int loadUserIndex();
+int refreshUserIndex();
+void stampUserFile();
+int userFileStampCurrent();
+int findUserByTicket(long long ticketCode);
+int findUserByName(const char *name);
+const UserRecord* getUserRecord(int index);
+int indexUser(long long ticketCode, const char *name);
+void unindexUser(long long ticketCode);
+
+// Core: ticket code allocator (4-digit free list, then random 40-bit codes)
+void resetTicketAllocator();
+void claimTicketCode(long long ticketCode);
+void releaseTicketCode(long long ticketCode);
+int pickFreeTicketCode();
+long long pickWideTicketCode();
+int ticketCodesAvailable();
 
 // Core: main navigation dashboards
 void userDashboard();
@@ -48,19 +232,128 @@ void adminViewAllEvents();
 void viewAllUsers();
 void removeUser();
 void viewEventDetailsOnly();
-char* getEventNameByID(int eventID);
+const char* getEventNameByID(int eventID);
+
+// Core: in-memory event catalog (loaded once, written through on change)
+int loadEventCatalog();
+int saveEventCatalog();
+int getEventCount();
+const EventRecord* getEventByID(int eventID);
+const EventRecord* getEventAt(int position);
+int parseEventLine(StrView line, EventRecord *ev);
+int isValidEventID(int eventID);
+void reserveEventID(int eventID);
+int appendEvent(EventRecord *event);
+int updateEvent(int eventID, const EventRecord *event);
+int deleteEvent(int eventID);
+
+// Core: events.idx line-offset index (direct reads, change detection)
+void resetEventIndex();
+int addEventIndexEntry(long offset);
+int saveEventIndex();
+int refreshEventCatalog();
+int readEventFromDisk(int eventID, EventRecord *out);
 
 // Core: booking system
 void bookSeat();
 void cancelBooking();
-void saveBooking(int eventID, const char *name);
+int saveBooking(int eventID, const char *name, int seats);
 void removeBooking(int eventID, const char *name);
 int removeBookingsByUserName(const char *name);
+int removeBookingsByEventID(int eventID);
 void viewAllBookings();
 void adminViewAllBookings();
+void adminOccupancyReport();
+int loadBookingRows(Vector *rows, const char *userName);
+
+// Core: append-only booking journal (bookings.txt)
+int loadBookingJournal();
+int readJournalEntries(int binary, Vector *entries);
+void reserveBookedEventIDs();
+int firstBookingOfUser(const char *name);
+int nextBookingOfUser(int index);
+int firstBookingOfEvent(int eventID);
+int nextBookingOfEvent(int index);
+const BookingRecord* getBookingRecord(int index);
+int getBookedQuantity(int eventID, const char *name);
+int compactBookingJournal();
+void compactBookingJournalIfNeeded();
+int syncBookingJournal();
+
+// Core: binary storage backend (events.bin / bookings.bin)
+void setStorageBackend(int binary);
+int isBinaryStorage();
+int readEventsBinary(Vector *events, int *nextID);
+int writeEventsBinary(const EventRecord *events, int count, int nextID);
+int readBookingsBinary(Vector *entries);
+int appendBookingBinary(int eventID, int quantity, const char *name);
+int writeBookingsBinary(const char *path, const BookingRecord *entries, int count);
+int convertStorage(int toBinary);
+int checkBinaryStorage();
+
+// Core: seat inventory (live booked count per event)
+void resetSeatInventory();
+void adjustBookedSeats(int eventID, int delta);
+int getBookedSeats(int eventID);
+int getSeatsRemaining(int eventID);
 
  
 
+// Growable containers for listing screens
+void vectorInit(Vector *v, size_t elemSize);
+void* vectorPush(Vector *v);
+void* vectorAt(const Vector *v, int index);
+void vectorFree(Vector *v);
+void stringListInit(StringList *list, Arena *arena);
+int stringListAdd(StringList *list, const char *text);
+int stringListAddf(StringList *list, const char *fmt, ...);
+
+// Screen arena (per-screen bump allocator for formatted text)
+void* arenaAlloc(Arena *arena, size_t size);
+char* arenaVStrf(Arena *arena, const char *fmt, va_list args);
+char* arenaStrf(Arena *arena, const char *fmt, ...);
+void arenaReset(Arena *arena);
+Arena* beginScreenArena(const char *label);
+void printScreenArenaStats();
+
+// Record codec (shared tokenizer for events, users and bookings files)
+int splitRecord(StrView line, char delim, StrView *fields, int maxFields);
+int viewToInt(StrView v, int *out);
+void viewCopy(StrView v, char *dst, size_t size);
+
+// Bulk loader (whole-file reads, SIMD delimiter search)
+const char* findByte(const char *p, const char *end, char c);
+const char* findByteScalar(const char *p, const char *end, char c);
+void setScalarByteScan(int enabled);
+void setRecordFileMapping(int enabled);
+int openRecordFile(RecordFile *rf, const char *path);
+int nextRecordLine(RecordFile *rf, StrView *line);
+void closeRecordFile(RecordFile *rf);
+int runLoaderBenchmark(int eventCount);
+
+// Durable file rewrites (unique temp file, fsync, atomic rename, batching)
+FILE* beginAtomicWrite(AtomicFile *af, const char *path, int binary);
+int commitAtomicWrite(AtomicFile *af);
+void abortAtomicWrite(AtomicFile *af);
+int deferWrite(int (*writer)(void));
+void beginWriteBatch();
+int endWriteBatch();
+
+// Terminal backend (Win32 console or POSIX termios/ANSI, kept at bottom of file)
+enum { TERM_DEFAULT, TERM_GREEN, TERM_CYAN, TERM_RED, TERM_YELLOW };
+void termInit();
+int termWidth();
+void termRefreshSize();
+void termMoveToColumn(int column);
+void termSetColor(int color);
+void termResetColor();
+int termGetKey();
+void termSleep(int ms);
+void termFlush();
+void termWrite(const char *text);
+void termPrintf(const char *fmt, ...);
+void termReadLine(char *buffer, int size);
+
 // UI & design helpers (kept at bottom of file)
 void clear();
 void welcomePage();
@@ -71,9 +364,12 @@ int getConsoleWidth();
 int calculateCenterPosition(int contentWidth);
 void printUnified(const char *str);
 void inputUnified(const char *prompt, char *buffer, int size);
-void inputUnifiedBlock(const char *prompt, char *buffer, int size);
-void printUnifiedBlockLeft(const char *str);
-void resetUnifiedBlock();
+void blockInit(UnifiedBlock *block, Arena *arena);
+void blockAdd(UnifiedBlock *block, const char *text);
+void blockAddf(UnifiedBlock *block, const char *fmt, ...);
+void blockReserve(UnifiedBlock *block, const char *prompt);
+void printUnifiedBlock(UnifiedBlock *block);
+void inputUnifiedBlock(const UnifiedBlock *block, const char *prompt, char *buffer, int size);
 void boxBordered(const char *text, int innerWidth);
 void printMenuItemsWithBoxes(const char *title, const char **items, int count);
 int visualLen(const char *s);
@@ -81,488 +377,727 @@ void printNotice(const char *msg, char type);
 void inputPasswordUnified(char *buffer, int size);
 
 /*
- * ========================= UNIFIED POSITIONING SYSTEM =========================
- * Ensures consistent alignment across all UI elements
+ * ========================= GROWABLE CONTAINERS =========================
+ * Vector holds fixed-size rows on the heap; StringList collects formatted
+ * menu rows in the screen arena. Listing screens never truncate at a fixed
+ * row count and don't need large stack frames.
  */
 
-static int unified_blockMaxLen = 0;
-static int unified_blockStartPos = -1;
-static int unified_blockFirstCall = 1;
-
-/*
- * ========================= AUTHENTICATION & LANDING PAGE =========================
- */
+// Prepares an empty vector whose elements are elemSize bytes
+void vectorInit(Vector *v, size_t elemSize)
+{
+    v->data = NULL;
+    v->count = 0;
+    v->capacity = 0;
+    v->elemSize = elemSize;
+}
 
-// Main entry point showing login, registration, and admin options
-void landingPage()
+// Appends a zeroed element and returns it, or NULL if memory ran out
+void* vectorPush(Vector *v)
 {
-    int choice;
-    static int splashShown = 0;
-    
-    while (1)
+    if (v->count == v->capacity)
     {
-        clear();
-        if (!splashShown)
-        {
-            welcomePage();
-            Sleep(1500);
-            clear();
-            splashShown = 1;
-        }
+        int newCapacity = v->capacity ? v->capacity * 2 : 16;
+        void *grown = realloc(v->data, (size_t)newCapacity * v->elemSize);
+        if (grown == NULL) return NULL;
+        v->data = grown;
+        v->capacity = newCapacity;
+    }
+    void *slot = (char *)v->data + (size_t)v->count * v->elemSize;
+    memset(slot, 0, v->elemSize);
+    v->count++;
+    return slot;
+}
 
-        // Header and individual boxed options
-        const char *menuItems[] = {
-            "1. New User Registration",
-            "2. Existing User Login",
-            "3. Admin Login",
-            "0. Exit"
-        };
-        printMenuItemsWithBoxes("Welcome to Event-Ease!", menuItems, 4);
-        
-        char buf[16];
-        inputUnified("Select an option: ", buf, sizeof(buf));
-        if (sscanf(buf, "%d", &choice) != 1)
-        {
-            printNotice("Invalid input. Please enter a number.", 'W');
-            printNotice("Press any key to continue...", 'I');
-            getch();
-            continue;
-        }
+// Returns the element at index (no bounds check beyond the caller's)
+void* vectorAt(const Vector *v, int index)
+{
+    return (char *)v->data + (size_t)index * v->elemSize;
+}
 
-        switch (choice)
-        {
-        case 1:
-            clear();
-            newUserRegistration();
-            break;
-        case 2:
-            clear();
-            existingUserLogin();
-            break;
-        case 3:
-            clear();
-            adminLogin();
-            break;
-        case 0:
-            clear();
-            printNotice("Thank you for using Event-Ease!", 'I');
-            printNotice("Goodbye!", 'I');
-            exit(0);
-        default:
-            printNotice("Invalid choice. Please select again.", 'W');
-            printNotice("Press any key to continue...", 'I');
-            getch();
-        }
-    }
+void vectorFree(Vector *v)
+{
+    free(v->data);
+    vectorInit(v, v->elemSize);
 }
 
-// Handles new user account creation with unique ticket code generation
-void newUserRegistration()
+void stringListInit(StringList *list, Arena *arena)
 {
-    char name[100];
-    int ticketCode;
-    
-    // Centered header and prompt for consistent alignment with notices
-    printUnified("=== New User Registration ===");
-    printUnified("");
+    list->items = NULL;
+    list->count = 0;
+    list->capacity = 0;
+    list->arena = arena;
+}
 
-    while (1)
+// Appends a string that outlives the list (a literal or arena text) without copying it
+int stringListAdd(StringList *list, const char *text)
+{
+    if (list->count == list->capacity)
     {
-        inputUnified("Enter your name: ", name, sizeof(name));
-        size_t len = strlen(name);
-        if (len > 0 && name[len - 1] == '\n') name[len - 1] = '\0';
+        // Arena memory is never moved, so growing means copying into a fresh array
+        int newCapacity = list->capacity ? list->capacity * 2 : 16;
+        const char **grown = arenaAlloc(list->arena, (size_t)newCapacity * sizeof(char *));
+        if (grown == NULL) return 0;
+        if (list->count > 0) memcpy(grown, list->items, (size_t)list->count * sizeof(char *));
+        list->items = grown;
+        list->capacity = newCapacity;
+    }
+    list->items[list->count++] = text;
+    return 1;
+}
 
-        // Validate name (check if not empty and not just spaces)
-        int valid = 0;
-        for (int i = 0; name[i] != '\0'; i++)
-        {
-            if (name[i] != ' ' && name[i] != '\t' && name[i] != '\n')
-            {
-                valid = 1;
-                break;
-            }
-        }
+/**
+ * Format a string into the list's arena and append it (printf-style).
+ * Returns 1 on success, 0 if memory ran out.
+ */
+int stringListAddf(StringList *list, const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    char *text = arenaVStrf(list->arena, fmt, args);
+    va_end(args);
+    return text != NULL && stringListAdd(list, text);
+}
 
-        if (!valid || strlen(name) == 0)
-        {
-            printNotice("Name cannot be empty. Please enter a valid name.", 'W');
-            printNotice("Press any key to try again...", 'I');
-            getch();
-            clear();
-            printUnified("=== New User Registration ===");
-            printUnified("");
-            continue;
-        }
+/*
+ * ========================= SCREEN ARENA =========================
+ * Bump allocator for everything a screen formats just to print it: menu
+ * rows, prompts and detail lines. Each screen claims the arena on entry with
+ * beginScreenArena, which releases whatever the previous screen allocated,
+ * so nothing is freed individually and no worst-case buffers live on the stack.
+ */
 
-        // Check if name already exists
-        if (isNameExists(name))
+#define ARENA_BLOCK_MIN 4096
+#define ARENA_MAX_SCREENS 32
+
+static Arena screenArena = { NULL, NULL, 0, 0 };
+static ScreenArenaStats screenArenaStats[ARENA_MAX_SCREENS];
+static int screenArenaStatsCount = 0;
+
+// Adds a block with room for at least size bytes to the front of the chain
+static int arenaGrow(Arena *arena, size_t size)
+{
+    size_t blockSize = ARENA_BLOCK_MIN;
+    size_t lastSize = arena->head ? arena->head->size : 0;
+    if (blockSize < lastSize * 2) blockSize = lastSize * 2;
+    while (blockSize < size) blockSize *= 2;
+
+    ArenaBlock *block = malloc(sizeof(ArenaBlock) + blockSize);
+    if (block == NULL) return 0;
+    block->next = arena->head;
+    block->size = blockSize;
+    block->used = 0;
+    arena->head = block;
+    return 1;
+}
+
+// Returns size bytes aligned for any type, or NULL if memory ran out
+void* arenaAlloc(Arena *arena, size_t size)
+{
+    size = (size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+    if (arena->head == NULL || arena->head->size - arena->head->used < size)
+    {
+        if (!arenaGrow(arena, size)) return NULL;
+    }
+    void *p = arena->head->data + arena->head->used;
+    arena->head->used += size;
+    arena->bytesUsed += size;
+    arena->allocations++;
+    return p;
+}
+
+/**
+ * vprintf into arena memory, or NULL if memory ran out.
+ * The text is formatted straight into the free end of the current block and
+ * claimed if it fits; only text that does not fit is formatted a second time.
+ */
+char* arenaVStrf(Arena *arena, const char *fmt, va_list args)
+{
+    va_list again;
+    va_copy(again, args);
+    int len;
+    ArenaBlock *head = arena->head;
+    if (head != NULL && head->used < head->size)
+    {
+        size_t room = head->size - head->used;
+        len = vsnprintf(head->data + head->used, room, fmt, args);
+        if (len >= 0 && (size_t)len < room)
         {
-            printNotice("This name is already registered!", 'E');
-            printNotice("Please choose a different name.", 'I');
-            printNotice("Press any key to try again...", 'I');
-            getch();
-            clear();
-            printUnified("=== New User Registration ===");
-            printUnified("");
-            continue;
+            va_end(again);
+            return arenaAlloc(arena, (size_t)len + 1);  // Claims exactly the bytes just written
         }
-
-        // Name is valid and unique
-        break;
     }
-    
-    // Generate unique ticket code
-    ticketCode = generateUniqueTicketCode();
-    
-    if (ticketCode == -1)
+    else
     {
-        printNotice("Error: Unable to generate unique ticket code.", 'E');
-        printNotice("Please try again later.", 'I');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        len = vsnprintf(NULL, 0, fmt, args);
     }
-    
-    saveUserInfo(ticketCode, name);
-    strcpy(loggedInUserName, name);
-    
-    // Display registration success as bordered flash messages for UI consistency
-    char ticketMsg[100];
-    snprintf(ticketMsg, sizeof(ticketMsg), "Your ticket code is: %04d", ticketCode);
 
-    printNotice("Registration Successful!", 'S');
-    printNotice(ticketMsg, 'I');
-    printNotice("Please remember your ticket code for future logins.", 'I');
-    printNotice("Press any key to continue to your dashboard...", 'I');
-    
-    getch();
-    
-    clear();
-    userDashboard();
+    char *text = (len < 0) ? NULL : arenaAlloc(arena, (size_t)len + 1);
+    if (text != NULL) vsnprintf(text, (size_t)len + 1, fmt, again);
+    va_end(again);
+    return text;
 }
 
-// Manages existing user login with name and ticket code validation
-void existingUserLogin()
+// printf into arena memory; returns "" rather than NULL so callers can print it directly
+char* arenaStrf(Arena *arena, const char *fmt, ...)
 {
-    char name[100];
-    int ticketCode;
-
-    // Centered header and prompts using common pad based on the longest prompt
-    printUnified("=== User Login ===");
-    printUnified("");
-
-    const char *p1 = "Enter your name: ";
-    const char *p2 = "Enter your 4-digit ticket code: ";
-    int w1 = visualLen(p1);
-    int w2 = visualLen(p2);
-    int maxw = (w1 > w2) ? w1 : w2;
-    int pad = calculateCenterPosition(maxw);
+    va_list args;
+    va_start(args, fmt);
+    char *text = arenaVStrf(arena, fmt, args);
+    va_end(args);
+    return (text != NULL) ? text : "";
+}
 
-    // Draw both prompts at the same pad so colons align vertically
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-
-    COORD pos = csbi.dwCursorPosition;
-    pos.X = pad; SetConsoleCursorPosition(hConsole, pos);
-    printf("%s", p1); fflush(stdout);
-    pos.X += w1; SetConsoleCursorPosition(hConsole, pos);
-    fgets(name, sizeof(name), stdin);
-    size_t len = strlen(name);
-    if (len > 0 && name[len - 1] == '\n') name[len - 1] = '\0';
-
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-    pos = csbi.dwCursorPosition;
-    pos.X = pad; SetConsoleCursorPosition(hConsole, pos);
-    printf("%s", p2); fflush(stdout);
-    pos.X += w2; SetConsoleCursorPosition(hConsole, pos);
-    char ticketBuf[16];
-    fgets(ticketBuf, sizeof(ticketBuf), stdin);
-    len = strlen(ticketBuf);
-    if (len > 0 && ticketBuf[len - 1] == '\n') ticketBuf[len - 1] = '\0';
-    
-    if (sscanf(ticketBuf, "%d", &ticketCode) != 1)
+/**
+ * Release everything allocated from the arena.
+ * If the last screen spilled into several blocks they are merged into one
+ * block of the combined size, so the same screen fits in one block next time.
+ */
+void arenaReset(Arena *arena)
+{
+    if (arena->head == NULL) return;
+    if (arena->head->next != NULL)
     {
-        printNotice("Invalid ticket code format. Please enter a 4-digit number.", 'W');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        size_t total = 0;
+        ArenaBlock *block = arena->head;
+        while (block != NULL)
+        {
+            ArenaBlock *next = block->next;
+            total += block->size;
+            free(block);
+            block = next;
+        }
+        arena->head = NULL;
+        arenaGrow(arena, total);
     }
-    
-    // Validate ticket code range
-    if (ticketCode < 0 || ticketCode > 9999)
+    else
     {
-        printNotice("Invalid ticket code. Must be between 0000-9999.", 'W');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        arena->head->used = 0;
     }
-    
-    if (validateUserLogin(name, ticketCode))
+    arena->bytesUsed = 0;
+    arena->allocations = 0;
+}
+
+// Folds the finished screen's usage into its statistics slot
+static void recordScreenArenaStats()
+{
+    if (screenArena.label == NULL) return;
+    ScreenArenaStats *stats = NULL;
+    for (int i = 0; i < screenArenaStatsCount; i++)
     {
-        strcpy(loggedInUserName, name);
-        printNotice("Login successful!", 'S');
-        printNotice("Welcome back!", 'I');
-        printNotice("Press any key to continue to your dashboard...", 'I');
-        getch();
-    clear();
-        userDashboard();
+        if (strcmp(screenArenaStats[i].label, screenArena.label) == 0) { stats = &screenArenaStats[i]; break; }
     }
-    else
+    if (stats == NULL)
     {
-        printNotice("Invalid credentials. Name or ticket code does not match.", 'E');
-        printNotice("Please check your information and try again.", 'I');
-        printNotice("Press any key to continue...", 'I');
-        getch();
+        if (screenArenaStatsCount == ARENA_MAX_SCREENS) return;
+        stats = &screenArenaStats[screenArenaStatsCount++];
+        memset(stats, 0, sizeof(*stats));
+        stats->label = screenArena.label;
     }
+    stats->visits++;
+    stats->totalBytes += screenArena.bytesUsed;
+    stats->totalAllocations += screenArena.allocations;
+    if (screenArena.bytesUsed > stats->peakBytes) stats->peakBytes = screenArena.bytesUsed;
 }
 
-// Handles admin authentication with secure credentials
-void adminLogin()
+// Hands the shared arena to a screen, releasing the previous screen's strings
+Arena* beginScreenArena(const char *label)
 {
-    char username[50], password[50];
-
-    // Centered header and prompts using common pad so labels align
-    printUnified("=== Admin Login ===");
-    printUnified("");
-
-    const char *ap1 = "Username: ";
-    const char *ap2 = "Password: ";
-    int aw1 = visualLen(ap1), aw2 = visualLen(ap2);
-    int amaxw = (aw1 > aw2) ? aw1 : aw2;
-    int apad = calculateCenterPosition(amaxw);
+    recordScreenArenaStats();
+    arenaReset(&screenArena);
+    screenArena.label = label;
+    return &screenArena;
+}
 
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-
-    COORD pos = csbi.dwCursorPosition;
-    pos.X = apad; SetConsoleCursorPosition(hConsole, pos);
-    printf("%s", ap1); fflush(stdout);
-    pos.X += aw1; SetConsoleCursorPosition(hConsole, pos);
-    fgets(username, sizeof(username), stdin);
-    size_t len = strlen(username);
-    if (len > 0 && username[len - 1] == '\n') username[len - 1] = '\0';
-
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-    pos = csbi.dwCursorPosition;
-    pos.X = apad; SetConsoleCursorPosition(hConsole, pos);
-    // Use password prompt consistent with layout
-    printf("%s", ap2); fflush(stdout);
-    pos.X += aw2; SetConsoleCursorPosition(hConsole, pos);
-    // Read password hidden but starting at current cursor
-    int i = 0; char ch; password[0] = '\0';
-    while (i < (int)sizeof(password) - 1)
+// Writes per-screen arena usage to stderr; registered with atexit by --arena-stats
+void printScreenArenaStats()
+{
+    FILE *out = stderr;
+    recordScreenArenaStats();
+    screenArena.label = NULL;
+    fprintf(out, "%-24s %6s %10s %10s %8s\n", "Screen", "Visits", "Peak B", "Avg B", "Allocs");
+    for (int i = 0; i < screenArenaStatsCount; i++)
     {
-        ch = getch();
-        if (ch == '\r' || ch == '\n') break;
-        else if (ch == '\b' && i > 0) { i--; printf("\b \b"); fflush(stdout); }
-        else if (ch != '\b') { password[i++] = ch; printf("*" ); fflush(stdout); }
+        const ScreenArenaStats *s = &screenArenaStats[i];
+        fprintf(out, "%-24s %6d %10zu %10zu %8d\n", s->label, s->visits, s->peakBytes,
+                s->totalBytes / (size_t)s->visits, s->totalAllocations);
     }
-    password[i] = '\0';
-    printf("\n");
-    
-    if (strcmp(username, "admin") == 0 && strcmp(password, "strongpassword") == 0)
-    {
-    printf("\n");
-        printNotice("Admin login successful!", 'S');
-        printNotice("Access granted to admin panel.", 'I');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        clear();
-        adminDashboard();
+}
+
+/*
+ * ========================= RECORD CODEC =========================
+ * One tokenizer for all three data files. A line is split in place into
+ * string views (pointer + length into the line) without copying; callers
+ * copy only the fields they keep and parse numbers straight from the view.
+ *   events.txt     ID|Name|Venue|Date|Time|SeatCapacity   ('|')
+ *   user_info.txt  TicketCode,Name                        (',')
+ *   bookings.txt   EventID Name                           (' ')
+ */
+
+/**
+ * Split a line (as returned by nextRecordLine) into at most maxFields views
+ * separated by delim. A trailing '\r' is ignored; the last field keeps any
+ * remaining delimiters, so names may contain them.
+ * Returns the number of fields found.
+ */
+int splitRecord(StrView line, char delim, StrView *fields, int maxFields)
+{
+    const char *end = line.ptr + line.len;
+    if (end > line.ptr && end[-1] == '\r') end--;
+
+    int count = 0;
+    const char *start = line.ptr;
+    while (count < maxFields - 1)
+    {
+        const char *hit = findByte(start, end, delim);
+        if (hit == NULL) break;
+        fields[count].ptr = start;
+        fields[count].len = (int)(hit - start);
+        count++;
+        start = hit + 1;
     }
-    else
+    fields[count].ptr = start;
+    fields[count].len = (int)(end - start);
+    return count + 1;
+}
+
+/**
+ * Parse a decimal integer that fills the whole view (surrounding spaces allowed).
+ * Returns 1 on success, 0 if the view is not a number.
+ */
+int viewToInt(StrView v, int *out)
+{
+    const char *p = v.ptr, *end = v.ptr + v.len;
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    while (end > p && (end[-1] == ' ' || end[-1] == '\t')) end--;
+
+    int negative = 0;
+    if (p < end && (*p == '-' || *p == '+')) negative = (*p++ == '-');
+    if (p == end) return 0;
+
+    long long value = 0;
+    for (; p < end; p++)
     {
-    printf("\n");
-        printNotice("Invalid admin credentials.", 'E');
-        printNotice("Access denied.", 'E');
-        printNotice("Press any key to continue...", 'I');
-        getch();
+        if (*p < '0' || *p > '9') return 0;
+        value = value * 10 + (*p - '0');
+        if (value > 2147483647LL) return 0;
     }
+    *out = negative ? (int)-value : (int)value;
+    return 1;
 }
 
-// Generates a unique 4-digit ticket code for new users
-int generateUniqueTicketCode()
+// Copies a view into a fixed buffer, truncating like the old %99[...] scans
+void viewCopy(StrView v, char *dst, size_t size)
 {
-    int maxAttempts = 1000;
-    int attempts = 0;
-    
-    while (attempts < maxAttempts)
+    size_t n = (size_t)v.len;
+    if (n >= size) n = size - 1;
+    memcpy(dst, v.ptr, n);
+    dst[n] = '\0';
+}
+
+/*
+ * ========================= BULK LOADER =========================
+ * Data files are read whole into one buffer and walked line by line in a
+ * single pass. Line and field delimiters are located with SSE2/AVX2 byte
+ * compares (16 or 32 bytes per step) where the compiler targets them, and
+ * with a plain loop otherwise. Run with --bench to compare against the old
+ * fgets + sscanf path.
+ *
+ * With --mmap the files are mapped read-only instead of copied: nothing is
+ * read up front, pages come straight from the OS page cache (shared by
+ * every running instance), and line views point into the mapping.
+ */
+
+static int recordFileMapping = 0;
+static int scalarByteScan = 0;  // findByte sticks to the plain loop (--bench)
+
+// Index of the lowest set bit; mask must be non-zero
+static int lowestSetBit(unsigned int mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (int)index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+// Scalar fallback for findByte (also used for the tail of a SIMD scan)
+const char* findByteScalar(const char *p, const char *end, char c)
+{
+    for (; p < end; p++)
     {
-        int ticketCode = rand() % 10000; // Generate 0-9999
-        
-        if (!isTicketCodeExists(ticketCode))
-        {
-            return ticketCode;
-        }
-        
-        attempts++;
+        if (*p == c) return p;
     }
-    
-    return -1; // Failed to generate unique code
+    return NULL;
 }
 
-// Checks if a ticket code already exists in the system
-int isTicketCodeExists(int ticketCode)
+/**
+ * Find the first c in [p, end).
+ * Returns a pointer to it, or NULL if there is none.
+ */
+const char* findByte(const char *p, const char *end, char c)
 {
-    FILE *file = fopen(USER_INFO_FILE, "r");
-    if (file == NULL)
+    if (scalarByteScan) return findByteScalar(p, end, c);
+#if defined(EVENT_EASE_AVX2)
+    const __m256i needle32 = _mm256_set1_epi8(c);
+    while (end - p >= 32)
     {
-        return 0; // File doesn't exist, so code doesn't exist
+        __m256i chunk = _mm256_loadu_si256((const __m256i *)p);
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle32));
+        if (mask) return p + lowestSetBit(mask);
+        p += 32;
     }
-    
-    char line[200];
-    int existingTicket;
-    char existingName[100];
-    
-    while (fgets(line, sizeof(line), file))
+#endif
+#if defined(EVENT_EASE_SSE2)
+    const __m128i needle16 = _mm_set1_epi8(c);
+    while (end - p >= 16)
     {
-        if (sscanf(line, "%d,%99[^\n]", &existingTicket, existingName) == 2)
-        {
-            if (existingTicket == ticketCode)
-            {
-                fclose(file);
-                return 1; // Code exists
-            }
-        }
+        __m128i chunk = _mm_loadu_si128((const __m128i *)p);
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle16));
+        if (mask) return p + lowestSetBit(mask);
+        p += 16;
     }
-    
-    fclose(file);
-    return 0; // Code doesn't exist
+#endif
+    return findByteScalar(p, end, c);
 }
 
-// Checks if a username already exists in the system
-int isNameExists(const char *name)
+// Makes findByte use the scalar loop (1) or the SIMD scan (0), for --bench
+void setScalarByteScan(int enabled)
 {
-    FILE *file = fopen(USER_INFO_FILE, "r");
-    if (file == NULL)
+    scalarByteScan = enabled;
+}
+
+// Chooses between mapping data files (1) and reading them into memory (0)
+void setRecordFileMapping(int enabled)
+{
+    recordFileMapping = enabled;
+}
+
+/**
+ * Map a data file read-only.
+ * Returns 1 on success (an empty file maps to an empty view), 0 on failure.
+ */
+static int mapRecordFile(RecordFile *rf, const char *path)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return 0;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
     {
-        return 0; // File doesn't exist, so name doesn't exist
+        CloseHandle(file);
+        return 0;
     }
-    
-    char line[200];
-    int existingTicket;
-    char existingName[100];
-    
-    while (fgets(line, sizeof(line), file))
+    if (size.QuadPart == 0)
     {
-        if (sscanf(line, "%d,%99[^\n]", &existingTicket, existingName) == 2)
-        {
-            if (equalsIgnoreCase(existingName, name))
-            {
-                fclose(file);
-                return 1; // Name exists
-            }
-        }
+        CloseHandle(file);
+        return 1;
     }
-    
-    fclose(file);
-    return 0; // Name doesn't exist
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (mapping == NULL) return 0;
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping); // The view keeps the mapping alive
+    if (view == NULL) return 0;
+    rf->data = view;
+    rf->size = (size_t)size.QuadPart;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return 0;
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return 0;
+    }
+    if (st.st_size == 0)
+    {
+        close(fd);
+        return 1;
+    }
+    void *view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // The mapping keeps the file referenced
+    if (view == MAP_FAILED) return 0;
+    rf->data = view;
+    rf->size = (size_t)st.st_size;
+#endif
+    rf->mapped = 1;
+    return 1;
 }
 
-// Case-insensitive string equality without platform-specific functions
-int equalsIgnoreCase(const char *a, const char *b)
+/**
+ * Open a whole data file for nextRecordLine: mapped when --mmap is on,
+ * otherwise read into memory. The buffer is not NUL-terminated when mapped.
+ * Returns 1 on success, 0 if the file is missing or cannot be read.
+ */
+int openRecordFile(RecordFile *rf, const char *path)
 {
-    unsigned char ca, cb;
-    while (*a && *b)
+    rf->data = NULL;
+    rf->size = 0;
+    rf->pos = 0;
+    rf->mapped = 0;
+
+    if (recordFileMapping && mapRecordFile(rf, path)) return 1;
+
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return 0;
+
+    long size = -1;
+    if (fseek(file, 0, SEEK_END) == 0) size = ftell(file);
+    if (size < 0 || fseek(file, 0, SEEK_SET) != 0)
     {
-        ca = (unsigned char)*a;
-        cb = (unsigned char)*b;
-        if (tolower(ca) != tolower(cb)) return 0;
-        a++; b++;
+        fclose(file);
+        return 0;
     }
-    return *a == '\0' && *b == '\0';
+
+    rf->data = malloc((size_t)size + 1);
+    if (rf->data == NULL)
+    {
+        fclose(file);
+        return 0;
+    }
+    rf->size = fread(rf->data, 1, (size_t)size, file);
+    rf->data[rf->size] = '\0';
+    fclose(file);
+    return 1;
 }
 
 /**
- * Save user information (ticket code and name) to user_info.txt
- * Format: ticket,name
+ * Hand out the next line (without its '\n') as a view into the buffer.
+ * Returns 1 while lines remain, 0 at end of file.
  */
-void saveUserInfo(int ticketCode, const char *name)
+int nextRecordLine(RecordFile *rf, StrView *line)
 {
-    FILE *file = fopen(USER_INFO_FILE, "a");
-    if (file == NULL)
+    if (rf->pos >= rf->size) return 0;
+    const char *start = rf->data + rf->pos;
+    const char *end = rf->data + rf->size;
+    const char *newline = findByte(start, end, '\n');
+    if (newline == NULL) newline = end;
+
+    line->ptr = start;
+    line->len = (int)(newline - start);
+    rf->pos = (size_t)(newline - rf->data) + 1;
+    return 1;
+}
+
+void closeRecordFile(RecordFile *rf)
+{
+    if (rf->mapped)
     {
-        resetUnifiedBlock();
-    printNotice("Error: Unable to save user information.", 'E');
-        return;
+#ifdef _WIN32
+        UnmapViewOfFile(rf->data);
+#else
+        munmap(rf->data, rf->size);
+#endif
     }
-    
-    fprintf(file, "%04d,%s\n", ticketCode, name);
-    fclose(file);
+    else
+    {
+        free(rf->data);
+    }
+    rf->data = NULL;
+    rf->mapped = 0;
+    rf->size = rf->pos = 0;
 }
 
-/**
- * Validate user login credentials against stored data
- * Returns 1 if valid, 0 if invalid
+/*
+ * ========================= DURABLE WRITES =========================
+ * Every whole-file rewrite goes through beginAtomicWrite/commitAtomicWrite:
+ * the new contents are written to a uniquely named temp file next to the
+ * target, flushed to disk, then renamed over the target in one step, and the
+ * directory entry is flushed too. A crash leaves either the old file or the
+ * new one, never neither. A failed write leaves the target untouched.
+ *
+ * Rewrites that only mirror in-memory state (the event catalog, journal
+ * compaction) are requested through deferWrite. Inside beginWriteBatch /
+ * endWriteBatch each distinct writer runs once at the end of the batch, so an
+ * operation that changes several things pays for one rewrite per file.
  */
-int validateUserLogin(const char *name, int ticketCode)
+
+#define MAX_DEFERRED_WRITES 8
+
+static int writeBatchDepth = 0;
+static int (*deferredWrites[MAX_DEFERRED_WRITES])(void);
+static int deferredWriteCount = 0;
+
+#ifndef _WIN32
+// Flushes the directory holding path so a rename into it survives a crash
+static void syncParentDirectory(const char *path)
 {
-    FILE *file = fopen(USER_INFO_FILE, "r");
-    if (file == NULL)
+    char dir[260];
+    const char *slash = strrchr(path, '/');
+    if (slash == NULL)
     {
-        return 0; // No user file exists
+        snprintf(dir, sizeof(dir), ".");
     }
-    
-    char line[200];
-    int storedTicket;
-    char storedName[100];
-    
-    while (fgets(line, sizeof(line), file))
+    else
+    {
+        snprintf(dir, sizeof(dir), "%.*s", (int)(slash - path) + (slash == path), path);
+    }
+    int fd = open(dir, O_RDONLY);
+    if (fd < 0) return;
+    fsync(fd); // Not every file system supports this; the rename itself is still atomic
+    close(fd);
+}
+#endif
+
+/**
+ * Open a new temp file that will replace path when committed.
+ * binary selects "wb" over "w". Returns the stream to write to, or NULL.
+ */
+FILE* beginAtomicWrite(AtomicFile *af, const char *path, int binary)
+{
+    af->file = NULL;
+    snprintf(af->path, sizeof(af->path), "%s", path);
+#ifdef _WIN32
+    static unsigned int tempCounter = 0;
+    for (int attempt = 0; attempt < 100 && af->file == NULL; attempt++)
     {
-        if (sscanf(line, "%d,%99[^\n]", &storedTicket, storedName) == 2)
+        snprintf(af->tempPath, sizeof(af->tempPath), "%s.%lu.%u.tmp", path,
+                 (unsigned long)GetCurrentProcessId(), tempCounter++);
+        int fd = _open(af->tempPath, _O_WRONLY | _O_CREAT | _O_EXCL | (binary ? _O_BINARY : _O_TEXT),
+                       _S_IREAD | _S_IWRITE);
+        if (fd < 0)
         {
-            if (storedTicket == ticketCode && strcmp(storedName, name) == 0)
-            {
-                fclose(file);
-                return 1; // Match found
-            }
+            if (errno == EEXIST) continue;
+            return NULL;
+        }
+        af->file = _fdopen(fd, binary ? "wb" : "w");
+        if (af->file == NULL)
+        {
+            _close(fd);
+            remove(af->tempPath);
+            return NULL;
         }
     }
-    
-    fclose(file);
-    return 0; // No match found
+#else
+    snprintf(af->tempPath, sizeof(af->tempPath), "%s.XXXXXX", path);
+    int fd = mkstemp(af->tempPath);
+    if (fd < 0) return NULL;
+    struct stat st; // Keep the permissions of the file being replaced
+    fchmod(fd, (stat(path, &st) == 0) ? (st.st_mode & 0777) : 0644);
+    af->file = fdopen(fd, binary ? "wb" : "w");
+    if (af->file == NULL)
+    {
+        close(fd);
+        remove(af->tempPath);
+    }
+#endif
+    return af->file;
+}
+
+/**
+ * Flush the temp file to disk and rename it over the target.
+ * Returns 1 on success; on failure the temp file is removed and the target
+ * keeps its previous contents.
+ */
+int commitAtomicWrite(AtomicFile *af)
+{
+    if (af->file == NULL) return 0;
+    int ok = fflush(af->file) == 0;
+#ifdef _WIN32
+    ok = ok && _commit(_fileno(af->file)) == 0;
+#else
+    ok = ok && fsync(fileno(af->file)) == 0;
+#endif
+    if (fclose(af->file) != 0) ok = 0;
+    af->file = NULL;
+
+#ifdef _WIN32
+    ok = ok && MoveFileExA(af->tempPath, af->path, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+    ok = ok && rename(af->tempPath, af->path) == 0;
+    if (ok) syncParentDirectory(af->path);
+#endif
+    if (!ok) remove(af->tempPath);
+    return ok;
+}
+
+// Drops an unfinished rewrite; the target is not touched
+void abortAtomicWrite(AtomicFile *af)
+{
+    if (af->file != NULL) fclose(af->file);
+    af->file = NULL;
+    remove(af->tempPath);
+}
+
+/**
+ * Run writer now, or once at the end of the current batch.
+ * Returns writer's result, or 1 when it was deferred.
+ */
+int deferWrite(int (*writer)(void))
+{
+    if (writeBatchDepth == 0) return writer();
+    for (int i = 0; i < deferredWriteCount; i++)
+    {
+        if (deferredWrites[i] == writer) return 1;
+    }
+    if (deferredWriteCount == MAX_DEFERRED_WRITES) return writer();
+    deferredWrites[deferredWriteCount++] = writer;
+    return 1;
+}
+
+// Starts coalescing deferred rewrites; batches may nest
+void beginWriteBatch()
+{
+    writeBatchDepth++;
+}
+
+/**
+ * End a batch. The outermost end runs each deferred writer once, in the order
+ * they were first requested. Returns 1 if all of them succeeded.
+ */
+int endWriteBatch()
+{
+    if (writeBatchDepth == 0 || --writeBatchDepth > 0) return 1;
+    int ok = 1;
+    for (int i = 0; i < deferredWriteCount; i++)
+    {
+        if (!deferredWrites[i]()) ok = 0;
+    }
+    deferredWriteCount = 0;
+    return ok;
 }
 
 /*
- * ========================= NAVIGATION DASHBOARDS =========================
+ * ========================= AUTHENTICATION & LANDING PAGE =========================
  */
 
-void userDashboard()
+// Main entry point showing login, registration, and admin options
+void landingPage()
 {
     int choice;
-
+    static int splashShown = 0;
+    
     while (1)
     {
-        dashboardDesign();
-        // Show logged-in user at the top in a double-bordered box
-        if (strlen(loggedInUserName) > 0)
+        clear();
+        if (!splashShown)
         {
-            char who[200];
-            snprintf(who, sizeof(who), "Logged is as \"%s\".", loggedInUserName);
-            printNotice(who, 'I');
+            welcomePage();
+            termSleep(1500);
+            clear();
+            splashShown = 1;
         }
-        const char *userMenu[] = {
-            "1. View Event Details",
-            "2. Book Seat",
-            "3. Cancel Booking",
-            "4. View All Bookings",
-            "5. Logout",
+
+        // Header and individual boxed options
+        const char *menuItems[] = {
+            "1. New User Registration",
+            "2. Existing User Login",
+            "3. Admin Login",
             "0. Exit"
         };
-        printMenuItemsWithBoxes("User Dashboard", userMenu, 6);
+        printMenuItemsWithBoxes("Welcome to Event-Ease!", menuItems, 4);
         
-        // Get input using unified block positioning
-    char buf[16];
-    inputUnified("Select an option: ", buf, sizeof(buf));
-            
+        char buf[16];
+        inputUnified("Select an option: ", buf, sizeof(buf));
         if (sscanf(buf, "%d", &choice) != 1)
         {
-            resetUnifiedBlock();
-            printUnifiedBlockLeft("Invalid input. Please enter a number.");
-            printUnifiedBlockLeft("Press any key to continue...");
-            getch();
+            printNotice("Invalid input. Please enter a number.", 'W');
+            printNotice("Press any key to continue...", 'I');
+            termGetKey();
             continue;
         }
 
@@ -570,627 +1105,3171 @@ void userDashboard()
         {
         case 1:
             clear();
-            viewEventDetailsOnly();
+            newUserRegistration();
             break;
         case 2:
             clear();
-            bookSeat();
+            existingUserLogin();
             break;
         case 3:
             clear();
-            cancelBooking();
-            break;
-        case 4:
-            clear();
-            viewAllBookings();
+            adminLogin();
             break;
-        case 5:
-            clear();
-            strcpy(loggedInUserName, "");
-            printNotice("Successfully logged out!", 'S');
-            printNotice("Returning to main menu...", 'I');
-            Sleep(1500);
-            clear(); // Clear screen before returning to main menu
-            return;
         case 0:
             clear();
-            resetUnifiedBlock();
             printNotice("Thank you for using Event-Ease!", 'I');
-            printNotice("Press any key to exit...", 'I');
-            getch();
+            printNotice("Goodbye!", 'I');
             exit(0);
         default:
-            clear();
-            resetUnifiedBlock();
             printNotice("Invalid choice. Please select again.", 'W');
             printNotice("Press any key to continue...", 'I');
-            getch();
+            termGetKey();
         }
     }
 }
 
-// Admin control panel with enhanced red ASCII art display
-void adminDashboard()
+// Handles new user account creation with unique ticket code generation
+void newUserRegistration()
 {
-    int choice;
+    char name[100];
+    long long ticketCode;
+    
+    // Centered header and prompt for consistent alignment with notices
+    printUnified("=== New User Registration ===");
+    printUnified("");
+
     while (1)
     {
-        adminDashboardDesign();
-        const char *adminMenu[] = {
-            "1. View all bookings",
-            "2. Add Event",
-            "3. View All Events",
-            "4. View All Users",
-            "5. Remove User",
-            "6. Logout",
-            "0. Exit"
-        };
-        printMenuItemsWithBoxes("Admin Panel", adminMenu, 7);
-        
-        // Get input using unified block positioning
-    char buf[16];
-    inputUnified("Select an option: ", buf, sizeof(buf));
-            
-        if (sscanf(buf, "%d", &choice) != 1)
-        {
-            resetUnifiedBlock();
-            printNotice("Invalid input. Please enter a number.", 'W');
-            printNotice("Press any key to continue...", 'I');
-            getch();
-            continue;
+        inputUnified("Enter your name: ", name, sizeof(name));
+        size_t len = strlen(name);
+        if (len > 0 && name[len - 1] == '\n') name[len - 1] = '\0';
+
+        // Validate name (check if not empty and not just spaces)
+        int valid = 0;
+        for (int i = 0; name[i] != '\0'; i++)
+        {
+            if (name[i] != ' ' && name[i] != '\t' && name[i] != '\n')
+            {
+                valid = 1;
+                break;
+            }
         }
 
-        switch (choice)
+        if (!valid || strlen(name) == 0)
         {
-        case 1:
-            clear();
-            adminViewAllBookings();
-            break;
-        case 2:
-            clear();
-            addEvent();
-            break;
-        case 3:
-            clear();
-            adminViewAllEvents();
-            break;
-        case 4:
-            clear();
-            viewAllUsers();
-            break;
-        case 5:
-            clear();
-            removeUser();
-            break;
-        case 6:
-            clear();
-            printNotice("Logging out of admin panel", 'I');
-            Sleep(1500);
-            return; // Return to landing page
-        case 0:
+            printNotice("Name cannot be empty. Please enter a valid name.", 'W');
+            printNotice("Press any key to try again...", 'I');
+            termGetKey();
             clear();
-            resetUnifiedBlock();
-            printNotice("Thank you for using Event-Ease!", 'I');
-            printNotice("Press any key to exit...", 'I');
-            getch();
-            exit(0);
-        default:
+            printUnified("=== New User Registration ===");
+            printUnified("");
+            continue;
+        }
+
+        // Check if name already exists
+        if (isNameExists(name))
+        {
+            printNotice("This name is already registered!", 'E');
+            printNotice("Please choose a different name.", 'I');
+            printNotice("Press any key to try again...", 'I');
+            termGetKey();
             clear();
-            resetUnifiedBlock();
-            printNotice("Invalid choice. Please select again.", 'W');
-            printNotice("Press any key to continue...", 'I');
-            getch();
+            printUnified("=== New User Registration ===");
+            printUnified("");
+            continue;
         }
+
+        // Name is valid and unique
+        break;
+    }
+    
+    // Generate unique ticket code
+    ticketCode = generateUniqueTicketCode();
+    
+    if (ticketCode == -1)
+    {
+        printNotice("Error: Unable to generate unique ticket code.", 'E');
+        printNotice("Please try again later.", 'I');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+    
+    saveUserInfo(ticketCode, name);
+    strcpy(loggedInUserName, name);
+    
+    // Display registration success as bordered flash messages for UI consistency
+    char ticketText[16], ticketMsg[100];
+    formatTicketCode(ticketCode, ticketText, sizeof(ticketText));
+    snprintf(ticketMsg, sizeof(ticketMsg), "Your ticket code is: %s", ticketText);
+
+    printNotice("Registration Successful!", 'S');
+    printNotice(ticketMsg, 'I');
+    printNotice("Please remember your ticket code for future logins.", 'I');
+    printNotice("Press any key to continue to your dashboard...", 'I');
+    
+    termGetKey();
+    
+    clear();
+    userDashboard();
+}
+
+// Manages existing user login with name and ticket code validation
+void existingUserLogin()
+{
+    char name[100];
+    long long ticketCode;
+
+    // Centered header and prompts using common pad based on the longest prompt
+    printUnified("=== User Login ===");
+    printUnified("");
+
+    const char *p1 = "Enter your name: ";
+    const char *p2 = "Enter your ticket code: ";
+    int w1 = visualLen(p1);
+    int w2 = visualLen(p2);
+    int maxw = (w1 > w2) ? w1 : w2;
+    int pad = calculateCenterPosition(maxw);
+
+    // Draw both prompts at the same pad so colons align vertically
+    termMoveToColumn(pad);
+    termWrite(p1);
+    termReadLine(name, sizeof(name));
+
+    termMoveToColumn(pad);
+    termWrite(p2);
+    char ticketBuf[16];
+    termReadLine(ticketBuf, sizeof(ticketBuf));
+    
+    // Accepts both 4-digit codes (0000-9999) and 8-character codes like K7M2-9QXD
+    ticketCode = parseTicketCode(ticketBuf);
+    if (ticketCode < 0)
+    {
+        printNotice("Invalid ticket code format. Use your 4-digit or XXXX-XXXX code.", 'W');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+    
+    if (validateUserLogin(name, ticketCode))
+    {
+        strcpy(loggedInUserName, name);
+        printNotice("Login successful!", 'S');
+        printNotice("Welcome back!", 'I');
+        printNotice("Press any key to continue to your dashboard...", 'I');
+        termGetKey();
+    clear();
+        userDashboard();
+    }
+    else
+    {
+        printNotice("Invalid credentials. Name or ticket code does not match.", 'E');
+        printNotice("Please check your information and try again.", 'I');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+    }
+}
+
+// Handles admin authentication with secure credentials
+void adminLogin()
+{
+    char username[50], password[50];
+
+    // Centered header and prompts using common pad so labels align
+    printUnified("=== Admin Login ===");
+    printUnified("");
+
+    const char *ap1 = "Username: ";
+    const char *ap2 = "Password: ";
+    int aw1 = visualLen(ap1), aw2 = visualLen(ap2);
+    int amaxw = (aw1 > aw2) ? aw1 : aw2;
+    int apad = calculateCenterPosition(amaxw);
+
+    termMoveToColumn(apad);
+    termWrite(ap1);
+    termReadLine(username, sizeof(username));
+
+    termMoveToColumn(apad);
+    // Use password prompt consistent with layout
+    termWrite(ap2);
+    // Read password hidden but starting at current cursor
+    int i = 0; char ch; password[0] = '\0';
+    while (i < (int)sizeof(password) - 1)
+    {
+        ch = termGetKey();
+        if (ch == '\r' || ch == '\n') break;
+        else if (ch == '\b' && i > 0) { i--; termWrite("\b \b"); termFlush(); }
+        else if (ch != '\b') { password[i++] = ch; termWrite("*"); termFlush(); }
+    }
+    password[i] = '\0';
+    termWrite("\n");
+    
+    if (strcmp(username, "admin") == 0 && strcmp(password, "strongpassword") == 0)
+    {
+    termWrite("\n");
+        printNotice("Admin login successful!", 'S');
+        printNotice("Access granted to admin panel.", 'I');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        clear();
+        adminDashboard();
+    }
+    else
+    {
+    termWrite("\n");
+        printNotice("Invalid admin credentials.", 'E');
+        printNotice("Access denied.", 'E');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+    }
+}
+
+// Generates a unique ticket code for new users
+// Short 4-digit codes are handed out while any remain, then 40-bit codes
+long long generateUniqueTicketCode()
+{
+    refreshUserIndex();
+    long long ticketCode = pickFreeTicketCode();
+    if (ticketCode >= 0) return ticketCode;
+    return pickWideTicketCode();
+}
+
+// Checks if a ticket code already exists in the system
+int isTicketCodeExists(long long ticketCode)
+{
+    return findUserByTicket(ticketCode) >= 0;
+}
+
+// Checks if a username already exists in the system
+int isNameExists(const char *name)
+{
+    refreshUserIndex();
+    return findUserByName(name) >= 0;
+}
+
+// Case-insensitive string equality without platform-specific functions
+int equalsIgnoreCase(const char *a, const char *b)
+{
+    unsigned char ca, cb;
+    while (*a && *b)
+    {
+        ca = (unsigned char)*a;
+        cb = (unsigned char)*b;
+        if (tolower(ca) != tolower(cb)) return 0;
+        a++; b++;
+    }
+    return *a == '\0' && *b == '\0';
+}
+
+/**
+ * Save user information (ticket code and name) to user_info.txt
+ * Format: ticket,name
+ */
+void saveUserInfo(long long ticketCode, const char *name)
+{
+    int current = userFileStampCurrent();
+    FILE *file = fopen(USER_INFO_FILE, "a");
+    if (file == NULL)
+    {
+    printNotice("Error: Unable to save user information.", 'E');
+        return;
+    }
+    
+    char ticketText[16];
+    formatTicketCode(ticketCode, ticketText, sizeof(ticketText));
+    fprintf(file, "%s,%s\n", ticketText, name);
+    fclose(file);
+    indexUser(ticketCode, name);
+    if (current) stampUserFile();  // Otherwise the next refresh picks up the other writes too
+}
+
+/**
+ * Validate user login credentials against stored data
+ * Returns 1 if valid, 0 if invalid
+ */
+int validateUserLogin(const char *name, long long ticketCode)
+{
+    refreshUserIndex();
+    int r = findUserByTicket(ticketCode);
+    return r >= 0 && strcmp(getUserRecord(r)->name, name) == 0;
+}
+
+/*
+ * ========================= TICKET CODES =========================
+ * Codes 0000-9999 are the original short codes. Free ones are kept in an
+ * array with a reverse position table, so picking, claiming and releasing a
+ * code are all O(1) with no file I/O. Once they run out, new users get a
+ * random 40-bit code written as 8 Crockford base32 characters (XXXX-XXXX);
+ * the user index is consulted to rule out the rare collision.
+ */
+
+#define TICKET_CODE_SPACE 10000
+#define WIDE_TICKET_MIN (1LL << 35)  // Keeps the first base32 character non-zero
+#define WIDE_TICKET_MAX (1LL << 40)
+
+static const char ticketAlphabet[] = "0123456789ABCDEFGHJKMNPQRSTVWXYZ";
+
+static int freeTicketCodes[TICKET_CODE_SPACE];     // Unused codes, in no particular order
+static int freeTicketCodePos[TICKET_CODE_SPACE];   // Position in freeTicketCodes, or -1 if taken
+static int freeTicketCodeCount = 0;
+
+/**
+ * Write a ticket code in its display form: "0899" for short codes,
+ * "K7M2-9QXD" for 40-bit codes.
+ */
+void formatTicketCode(long long ticketCode, char *out, size_t size)
+{
+    if (ticketCode < TICKET_CODE_SPACE)
+    {
+        snprintf(out, size, "%04lld", ticketCode);
+        return;
+    }
+    char text[10];
+    for (int i = 8; i >= 0; i--)
+    {
+        if (i == 4) { text[i] = '-'; continue; }
+        text[i] = ticketAlphabet[ticketCode & 31];
+        ticketCode >>= 5;
+    }
+    snprintf(out, size, "%.9s", text);
+}
+
+// Maps one base32 character to its value (case-insensitive, O->0, I/L->1), or -1
+static int ticketSymbolValue(char c)
+{
+    c = (char)toupper((unsigned char)c);
+    if (c == 'O') c = '0';
+    if (c == 'I' || c == 'L') c = '1';
+    const char *hit = (c != '\0') ? strchr(ticketAlphabet, c) : NULL;
+    return hit ? (int)(hit - ticketAlphabet) : -1;
+}
+
+/**
+ * Parse a ticket code typed by a user or read from user_info.txt.
+ * Digit-only input up to 9999 is a short code; anything else must be
+ * 8 base32 characters (dashes and spaces ignored).
+ * Returns the code, or -1 if the text is not a valid code.
+ */
+long long parseTicketCode(const char *text)
+{
+    StrView view = { text, (int)strlen(text) };
+    return parseTicketCodeView(view);
+}
+
+// parseTicketCode for a field that is not NUL-terminated
+long long parseTicketCodeView(StrView view)
+{
+    const char *text = view.ptr, *end = view.ptr + view.len;
+    while (text < end && (*text == ' ' || *text == '\t')) text++;
+
+    int digits = 0, allDigits = 1;
+    long long value = 0;
+    for (const char *p = text; p < end && *p != '\r' && *p != '\n'; p++)
+    {
+        if (*p == ' ' || *p == '\t') continue;
+        if (!isdigit((unsigned char)*p)) { allDigits = 0; break; }
+        if (value <= TICKET_CODE_SPACE) value = value * 10 + (*p - '0');
+        digits++;
+    }
+    if (allDigits && digits > 0 && value < TICKET_CODE_SPACE)
+    {
+        return value;
+    }
+
+    int symbols = 0;
+    value = 0;
+    for (const char *p = text; p < end && *p != '\r' && *p != '\n'; p++)
+    {
+        if (*p == '-' || *p == ' ' || *p == '\t') continue;
+        int v = ticketSymbolValue(*p);
+        if (v < 0 || ++symbols > 8) return -1;
+        value = (value << 5) | v;
+    }
+    if (symbols != 8 || value < WIDE_TICKET_MIN) return -1;
+    return value;
+}
+
+/**
+ * Parse one user_info.txt line ("TicketCode,Name").
+ * Returns 1 if the line holds a valid user, 0 otherwise.
+ */
+int parseUserLine(StrView line, long long *ticketCode, char *name, size_t nameSize)
+{
+    StrView fields[2];
+    if (splitRecord(line, ',', fields, 2) != 2 || fields[1].len == 0) return 0;
+    *ticketCode = parseTicketCodeView(fields[0]);
+    if (*ticketCode < 0) return 0;
+    viewCopy(fields[1], name, nameSize);
+    return 1;
+}
+
+// Marks every short code as free; the user index then claims the ones in use
+void resetTicketAllocator()
+{
+    for (int code = 0; code < TICKET_CODE_SPACE; code++)
+    {
+        freeTicketCodes[code] = code;
+        freeTicketCodePos[code] = code;
+    }
+    freeTicketCodeCount = TICKET_CODE_SPACE;
+}
+
+// Removes a short code from the free list (swap with the last free entry)
+void claimTicketCode(long long ticketCode)
+{
+    if (ticketCode < 0 || ticketCode >= TICKET_CODE_SPACE) return;
+    int pos = freeTicketCodePos[ticketCode];
+    if (pos < 0) return; // Already taken
+
+    int last = freeTicketCodes[--freeTicketCodeCount];
+    freeTicketCodes[pos] = last;
+    freeTicketCodePos[last] = pos;
+    freeTicketCodePos[ticketCode] = -1;
+}
+
+// Returns a short code to the free list
+void releaseTicketCode(long long ticketCode)
+{
+    if (ticketCode < 0 || ticketCode >= TICKET_CODE_SPACE) return;
+    if (freeTicketCodePos[ticketCode] >= 0) return; // Already free
+
+    freeTicketCodes[freeTicketCodeCount] = (int)ticketCode;
+    freeTicketCodePos[ticketCode] = freeTicketCodeCount;
+    freeTicketCodeCount++;
+}
+
+// Returns a random unused short code without claiming it, or -1 if none are left
+int pickFreeTicketCode()
+{
+    if (freeTicketCodeCount == 0) return -1;
+    return freeTicketCodes[rand() % freeTicketCodeCount];
+}
+
+// Returns a random unused 40-bit code; with ~10^12 codes a retry is almost never needed
+long long pickWideTicketCode()
+{
+    while (1)
+    {
+        long long r = ((long long)(rand() & 0x7FFF) << 30)
+                    | ((long long)(rand() & 0x7FFF) << 15)
+                    | (long long)(rand() & 0x7FFF);
+        r &= WIDE_TICKET_MAX - 1;
+        if (r >= WIDE_TICKET_MIN && !isTicketCodeExists(r)) return r;
+    }
+}
+
+// Number of 4-digit ticket codes that can still be handed out
+int ticketCodesAvailable()
+{
+    return freeTicketCodeCount;
+}
+
+/*
+ * ========================= USER INDEX =========================
+ * user_info.txt is loaded once into memory with two open-addressing hash
+ * tables on top: one keyed by ticket code and one by case-folded name.
+ * saveUserInfo and removeUser keep it in sync with the file, and the
+ * ticket code allocator in sync with the index. The file's size and mtime
+ * are stamped at load; refreshUserIndex reloads when another running copy
+ * has changed the file since.
+ */
+
+#define USER_SLOT_EMPTY -1
+#define USER_SLOT_DELETED -2
+
+static UserRecord *userRecords = NULL;
+static int userRecordCount = 0;
+static int userRecordCapacity = 0;
+static int *userTicketSlots = NULL;  // Hash slot -> index into userRecords
+static int *userNameSlots = NULL;
+static int userSlotCount = 0;        // Always a power of two
+static int userSlotsUsed = 0;        // Live entries plus tombstones
+static uint64_t userFileStampSize = 0;  // user_info.txt as of the last load or own write
+static int64_t userFileStampMtime = 0;
+
+static unsigned int hashTicketCode(long long ticketCode)
+{
+    unsigned long long h = (unsigned long long)ticketCode;
+    h ^= h >> 33; h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33; h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return (unsigned int)h;
+}
+
+// FNV-1a over the lower-cased name so lookups match equalsIgnoreCase
+static unsigned int hashUserName(const char *name)
+{
+    unsigned int h = 2166136261U;
+    for (const unsigned char *p = (const unsigned char *)name; *p; p++)
+    {
+        h ^= (unsigned int)tolower(*p);
+        h *= 16777619U;
+    }
+    return h;
+}
+
+// Rebuilds both hash tables with room for at least `needed` users, dropping removed records
+static int rebuildUserSlots(int needed)
+{
+    int size = 64;
+    while (size < needed * 2) size *= 2;
+
+    int *tickets = malloc((size_t)size * sizeof(int));
+    int *names = malloc((size_t)size * sizeof(int));
+    if (tickets == NULL || names == NULL)
+    {
+        free(tickets);
+        free(names);
+        return 0;
+    }
+    for (int i = 0; i < size; i++) tickets[i] = names[i] = USER_SLOT_EMPTY;
+
+    // Compact live records so indexes stay dense
+    int live = 0;
+    for (int i = 0; i < userRecordCount; i++)
+    {
+        if (userRecords[i].active) userRecords[live++] = userRecords[i];
+    }
+    userRecordCount = live;
+
+    free(userTicketSlots);
+    free(userNameSlots);
+    userTicketSlots = tickets;
+    userNameSlots = names;
+    userSlotCount = size;
+    userSlotsUsed = 0;
+
+    for (int i = 0; i < userRecordCount; i++)
+    {
+        unsigned int mask = (unsigned int)size - 1;
+        unsigned int t = hashTicketCode(userRecords[i].ticket) & mask;
+        while (tickets[t] != USER_SLOT_EMPTY) t = (t + 1) & mask;
+        tickets[t] = i;
+        unsigned int n = hashUserName(userRecords[i].name) & mask;
+        while (names[n] != USER_SLOT_EMPTY) n = (n + 1) & mask;
+        names[n] = i;
+        userSlotsUsed++;
+    }
+    return 1;
+}
+
+/**
+ * Returns the index of the user holding ticketCode, or -1 if none.
+ */
+int findUserByTicket(long long ticketCode)
+{
+    if (userSlotCount == 0) return -1;
+    unsigned int mask = (unsigned int)userSlotCount - 1;
+    unsigned int i = hashTicketCode(ticketCode) & mask;
+    while (userTicketSlots[i] != USER_SLOT_EMPTY)
+    {
+        int r = userTicketSlots[i];
+        if (r >= 0 && userRecords[r].ticket == ticketCode) return r;
+        i = (i + 1) & mask;
+    }
+    return -1;
+}
+
+/**
+ * Returns the index of the user with this name (case-insensitive), or -1 if none.
+ */
+int findUserByName(const char *name)
+{
+    if (userSlotCount == 0) return -1;
+    unsigned int mask = (unsigned int)userSlotCount - 1;
+    unsigned int i = hashUserName(name) & mask;
+    while (userNameSlots[i] != USER_SLOT_EMPTY)
+    {
+        int r = userNameSlots[i];
+        if (r >= 0 && equalsIgnoreCase(userRecords[r].name, name)) return r;
+        i = (i + 1) & mask;
+    }
+    return -1;
+}
+
+// Returns the user stored at an index returned by findUserByTicket/findUserByName
+const UserRecord* getUserRecord(int index)
+{
+    if (index < 0 || index >= userRecordCount) return NULL;
+    return &userRecords[index];
+}
+
+/**
+ * Add a user to the in-memory index (does not touch the file).
+ * Returns 1 on success, 0 if memory could not be allocated.
+ */
+int indexUser(long long ticketCode, const char *name)
+{
+    if (userRecordCount + 1 > userRecordCapacity)
+    {
+        int newCapacity = userRecordCapacity ? userRecordCapacity * 2 : 64;
+        UserRecord *grown = realloc(userRecords, (size_t)newCapacity * sizeof(UserRecord));
+        if (grown == NULL) return 0;
+        userRecords = grown;
+        userRecordCapacity = newCapacity;
+    }
+    // Keep the load factor (tombstones included) at or below one half
+    if ((userSlotsUsed + 1) * 2 > userSlotCount)
+    {
+        if (!rebuildUserSlots(userRecordCount + 1)) return 0;
+    }
+
+    int r = userRecordCount++;
+    userRecords[r].ticket = ticketCode;
+    snprintf(userRecords[r].name, sizeof(userRecords[r].name), "%s", name);
+    userRecords[r].active = 1;
+
+    unsigned int mask = (unsigned int)userSlotCount - 1;
+    unsigned int t = hashTicketCode(ticketCode) & mask;
+    while (userTicketSlots[t] >= 0) t = (t + 1) & mask;
+    userTicketSlots[t] = r;
+    unsigned int n = hashUserName(name) & mask;
+    while (userNameSlots[n] >= 0) n = (n + 1) & mask;
+    userNameSlots[n] = r;
+    userSlotsUsed++;
+    claimTicketCode(ticketCode);
+    return 1;
+}
+
+/**
+ * Remove the user holding ticketCode from the in-memory index.
+ */
+void unindexUser(long long ticketCode)
+{
+    int r = findUserByTicket(ticketCode);
+    if (r < 0) return;
+
+    unsigned int mask = (unsigned int)userSlotCount - 1;
+    unsigned int t = hashTicketCode(ticketCode) & mask;
+    while (userTicketSlots[t] != r) t = (t + 1) & mask;
+    userTicketSlots[t] = USER_SLOT_DELETED;
+    unsigned int n = hashUserName(userRecords[r].name) & mask;
+    while (userNameSlots[n] != r) n = (n + 1) & mask;
+    userNameSlots[n] = USER_SLOT_DELETED;
+    userRecords[r].active = 0;
+    releaseTicketCode(ticketCode);
+}
+
+// Size and mtime of user_info.txt; returns 0 if it does not exist
+static int statUserFile(uint64_t *size, int64_t *mtime)
+{
+    struct stat st;
+    if (stat(USER_INFO_FILE, &st) != 0) return 0;
+    *size = (uint64_t)st.st_size;
+    *mtime = (int64_t)st.st_mtime;
+    return 1;
+}
+
+// Records that the index matches user_info.txt as it is now
+void stampUserFile()
+{
+    if (!statUserFile(&userFileStampSize, &userFileStampMtime))
+    {
+        userFileStampSize = 0;
+        userFileStampMtime = 0;
+    }
+}
+
+// 1 if nobody but us has written user_info.txt since it was stamped
+int userFileStampCurrent()
+{
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    statUserFile(&size, &mtime);
+    return size == userFileStampSize && mtime == userFileStampMtime;
+}
+
+/**
+ * Build the user index from user_info.txt.
+ * Returns the number of users loaded.
+ */
+int loadUserIndex()
+{
+    stampUserFile();  // Before reading, so a write racing the load triggers another
+    userRecordCount = 0;
+    resetTicketAllocator();
+    if (!rebuildUserSlots(0)) return 0;
+
+    RecordFile file;
+    if (!openRecordFile(&file, USER_INFO_FILE))
+    {
+        return 0; // No users yet
+    }
+
+    StrView line;
+    long long ticketCode;
+    char name[100];
+    while (nextRecordLine(&file, &line))
+    {
+        if (parseUserLine(line, &ticketCode, name, sizeof(name)))
+        {
+            indexUser(ticketCode, name);
+        }
+    }
+    closeRecordFile(&file);
+    return userRecordCount;
+}
+
+/**
+ * Reload the user index if user_info.txt changed since it was loaded (a user
+ * registered or removed by another running copy). Checked before every
+ * lookup that decides a login, a name or a new ticket code.
+ * Returns 1 if the index was reloaded, 0 if it was already current.
+ */
+int refreshUserIndex()
+{
+    if (userFileStampCurrent()) return 0;
+    loadUserIndex();
+    return 1;
+}
+
+/*
+ * ========================= NAVIGATION DASHBOARDS =========================
+ */
+
+void userDashboard()
+{
+    int choice;
+
+    while (1)
+    {
+        clear(); // Redraws over the same rows, so only what changed is sent
+        dashboardDesign();
+        // Show logged-in user at the top in a double-bordered box
+        if (strlen(loggedInUserName) > 0)
+        {
+            char who[200];
+            snprintf(who, sizeof(who), "Logged is as \"%s\".", loggedInUserName);
+            printNotice(who, 'I');
+        }
+        const char *userMenu[] = {
+            "1. View Event Details",
+            "2. Book Seat",
+            "3. Cancel Booking",
+            "4. View All Bookings",
+            "5. Logout",
+            "0. Exit"
+        };
+        printMenuItemsWithBoxes("User Dashboard", userMenu, 6);
+        
+        // Get input using unified block positioning
+    char buf[16];
+    inputUnified("Select an option: ", buf, sizeof(buf));
+            
+        if (sscanf(buf, "%d", &choice) != 1)
+        {
+            printNotice("Invalid input. Please enter a number.", 'W');
+            printNotice("Press any key to continue...", 'I');
+            termGetKey();
+            continue;
+        }
+
+        switch (choice)
+        {
+        case 1:
+            clear();
+            viewEventDetailsOnly();
+            break;
+        case 2:
+            clear();
+            bookSeat();
+            break;
+        case 3:
+            clear();
+            cancelBooking();
+            break;
+        case 4:
+            clear();
+            viewAllBookings();
+            break;
+        case 5:
+            clear();
+            strcpy(loggedInUserName, "");
+            printNotice("Successfully logged out!", 'S');
+            printNotice("Returning to main menu...", 'I');
+            termSleep(1500);
+            clear(); // Clear screen before returning to main menu
+            return;
+        case 0:
+            clear();
+            printNotice("Thank you for using Event-Ease!", 'I');
+            printNotice("Press any key to exit...", 'I');
+            termGetKey();
+            exit(0);
+        default:
+            printNotice("Invalid choice. Please select again.", 'W');
+            printNotice("Press any key to continue...", 'I');
+            termGetKey();
+        }
+    }
+}
+
+// Admin control panel with enhanced red ASCII art display
+void adminDashboard()
+{
+    int choice;
+    while (1)
+    {
+        clear();
+        adminDashboardDesign();
+        const char *adminMenu[] = {
+            "1. View all bookings",
+            "2. Add Event",
+            "3. View All Events",
+            "4. View All Users",
+            "5. Remove User",
+            "6. Occupancy Report",
+            "7. Logout",
+            "0. Exit"
+        };
+        printMenuItemsWithBoxes("Admin Panel", adminMenu, 8);
+        
+        // Get input using unified block positioning
+    char buf[16];
+    inputUnified("Select an option: ", buf, sizeof(buf));
+            
+        if (sscanf(buf, "%d", &choice) != 1)
+        {
+            printNotice("Invalid input. Please enter a number.", 'W');
+            printNotice("Press any key to continue...", 'I');
+            termGetKey();
+            continue;
+        }
+
+        switch (choice)
+        {
+        case 1:
+            clear();
+            adminViewAllBookings();
+            break;
+        case 2:
+            clear();
+            addEvent();
+            break;
+        case 3:
+            clear();
+            adminViewAllEvents();
+            break;
+        case 4:
+            clear();
+            viewAllUsers();
+            break;
+        case 5:
+            clear();
+            removeUser();
+            break;
+        case 6:
+            clear();
+            adminOccupancyReport();
+            break;
+        case 7:
+            clear();
+            printNotice("Logging out of admin panel", 'I');
+            termSleep(1500);
+            return; // Return to landing page
+        case 0:
+            clear();
+            printNotice("Thank you for using Event-Ease!", 'I');
+            printNotice("Press any key to exit...", 'I');
+            termGetKey();
+            exit(0);
+        default:
+            printNotice("Invalid choice. Please select again.", 'W');
+            printNotice("Press any key to continue...", 'I');
+            termGetKey();
+        }
+    }
+}
+
+/*
+ * ========================= EVENT CATALOG =========================
+ * events.txt is parsed once into memory; every screen reads from here and
+ * every change is written straight back to the file.
+ * Each event carries a persistent ID (the first field of its line) that
+ * bookings refer to, and a direct-index table maps an ID to the event's
+ * position so lookups by ID are O(1). A new event gets the next ID above
+ * every one still used by an event or a booking record. events.bin also
+ * keeps the highest ID ever issued, so there IDs are never reused. events.txt
+ * does not: once compaction has dropped a deleted event's bookings, a restart
+ * may give its ID to a new event, as nothing refers to it any more.
+ * IDs run from 1 to MAX_EVENT_ID, which bounds every table indexed by ID
+ * (a few MB at most). A larger ID read from a file is treated like a missing
+ * one and the event gets a fresh ID.
+ */
+
+#define MAX_EVENT_ID 1000000
+
+static EventRecord *eventCatalog = NULL;
+static int eventCatalogCount = 0;
+static int eventCatalogCapacity = 0;
+static int eventCatalogLoaded = 0;
+static int *eventSlotByID = NULL;  // Event ID -> position in eventCatalog, or -1
+static int eventSlotCount = 0;
+static int nextEventID = 1;
+
+// Grows the catalog array so it can hold at least `needed` events
+static int reserveEventCatalog(int needed)
+{
+    if (needed <= eventCatalogCapacity) return 1;
+    int newCapacity = eventCatalogCapacity ? eventCatalogCapacity * 2 : 16;
+    while (newCapacity < needed) newCapacity *= 2;
+    EventRecord *grown = realloc(eventCatalog, (size_t)newCapacity * sizeof(EventRecord));
+    if (grown == NULL) return 0;
+    eventCatalog = grown;
+    eventCatalogCapacity = newCapacity;
+    return 1;
+}
+
+// 1 if eventID is in the range the ID-indexed tables accept
+int isValidEventID(int eventID)
+{
+    return eventID > 0 && eventID <= MAX_EVENT_ID;
+}
+
+// Points eventSlotByID[eventID] at a catalog position (-1 to clear it)
+static int setEventSlot(int eventID, int position)
+{
+    if (!isValidEventID(eventID)) return 0;
+    if (eventID >= eventSlotCount)
+    {
+        int newCount = eventSlotCount ? eventSlotCount : 64;
+        while (newCount <= eventID) newCount *= 2;  // Stays below 2 * MAX_EVENT_ID
+        int *grown = realloc(eventSlotByID, (size_t)newCount * sizeof(int));
+        if (grown == NULL) return 0;
+        for (int i = eventSlotCount; i < newCount; i++) grown[i] = -1;
+        eventSlotByID = grown;
+        eventSlotCount = newCount;
+    }
+    eventSlotByID[eventID] = position;
+    return 1;
+}
+
+// Makes sure new events get IDs above eventID (also used for IDs seen in bookings)
+void reserveEventID(int eventID)
+{
+    if (isValidEventID(eventID) && eventID >= nextEventID) nextEventID = eventID + 1;
+}
+
+/**
+ * Parse one events.txt line. Lines are "ID|Name|Venue|Date|Time|SeatCapacity";
+ * lines in the older format without an ID, or with an ID above MAX_EVENT_ID,
+ * are accepted with id set to 0.
+ * Returns 1 if the line holds a valid event, 0 otherwise.
+ */
+int parseEventLine(StrView line, EventRecord *ev)
+{
+    StrView f[7];
+    int count = splitRecord(line, '|', f, 7);
+    const StrView *text = f;
+
+    if (count >= 6)
+    {
+        if (!viewToInt(f[0], &ev->id) || ev->id <= 0) return 0;
+        if (ev->id > MAX_EVENT_ID) ev->id = 0;  // Too large to index: gets a fresh ID
+        text = f + 1;
+    }
+    else if (count == 5)
+    {
+        ev->id = 0;
+    }
+    else
+    {
+        return 0;
+    }
+
+    for (int i = 0; i < 4; i++) if (text[i].len == 0) return 0;
+    if (!viewToInt(text[4], &ev->seatCapacity)) return 0;
+    viewCopy(text[0], ev->name, sizeof(ev->name));
+    viewCopy(text[1], ev->venue, sizeof(ev->venue));
+    viewCopy(text[2], ev->date, sizeof(ev->date));
+    viewCopy(text[3], ev->time, sizeof(ev->time));
+    return 1;
+}
+
+/**
+ * Load every event from events.txt (or events.bin with the binary backend)
+ * into the catalog.
+ * Events from files written before IDs existed get their old position as
+ * their ID, so existing bookings keep pointing at the same event, and the
+ * file is rewritten in the new format. The first start on the binary
+ * backend imports events.txt the same way.
+ * Returns the number of events loaded (0 if the file is missing).
+ */
+int loadEventCatalog()
+{
+    eventCatalogCount = 0;
+    eventCatalogLoaded = 1;
+    nextEventID = 1;
+    for (int i = 0; i < eventSlotCount; i++) eventSlotByID[i] = -1;
+
+    int needsMigration = 0;
+    int fromBinary = 0;
+    if (isBinaryStorage())
+    {
+        Vector stored;
+        vectorInit(&stored, sizeof(EventRecord));
+        int storedNextID = 1;
+        int result = readEventsBinary(&stored, &storedNextID);
+        if (result > 0 && reserveEventCatalog(stored.count))
+        {
+            if (stored.count > 0) memcpy(eventCatalog, stored.data, (size_t)stored.count * sizeof(EventRecord));
+            eventCatalogCount = stored.count;
+            reserveEventID(storedNextID - 1);
+            fromBinary = 1;
+        }
+        else if (result == 0)
+        {
+            needsMigration = 1; // No events.bin yet: import events.txt
+        }
+        vectorFree(&stored);
+        if (result != 0 && !fromBinary)
+        {
+            return 0; // Unreadable events.bin: never replace it with events.txt
+        }
+    }
+
+    RecordFile file;
+    resetEventIndex();
+    if (!fromBinary && openRecordFile(&file, EVENTS_FILE))
+    {
+        StrView line;
+        EventRecord ev;
+        while (nextRecordLine(&file, &line))
+        {
+            if (!parseEventLine(line, &ev)) continue;
+            if (!reserveEventCatalog(eventCatalogCount + 1)) break;
+            if (ev.id == 0) needsMigration = 1;
+            addEventIndexEntry((long)(line.ptr - file.data));
+            eventCatalog[eventCatalogCount++] = ev;
+        }
+        closeRecordFile(&file);
+    }
+    else if (!fromBinary && !needsMigration)
+    {
+        return 0; // No events yet
+    }
+
+    // Explicit IDs first; a duplicate ID is treated as missing
+    for (int i = 0; i < eventCatalogCount; i++)
+    {
+        int id = eventCatalog[i].id;
+        if (id == 0) continue;
+        if (id < eventSlotCount && eventSlotByID[id] >= 0)
+        {
+            eventCatalog[i].id = 0;
+            needsMigration = 1;
+            continue;
+        }
+        setEventSlot(id, i);
+        reserveEventID(id);
+    }
+    // Old-format lines: keep the positional ID they always had if it is free
+    for (int i = 0; i < eventCatalogCount; i++)
+    {
+        if (eventCatalog[i].id != 0) continue;
+        needsMigration = 1;
+        int id = i + 1;
+        if (id < eventSlotCount && eventSlotByID[id] >= 0) id = nextEventID;
+        eventCatalog[i].id = id;
+        setEventSlot(id, i);
+        reserveEventID(id);
+    }
+
+    if (needsMigration)
+    {
+        saveEventCatalog();
+    }
+    else if (!fromBinary)
+    {
+        saveEventIndex();
+    }
+    return eventCatalogCount;
+}
+
+// Rewrites the catalog file (and its index) from memory
+static int writeEventCatalog()
+{
+    if (isBinaryStorage())
+    {
+        return writeEventsBinary(eventCatalog, eventCatalogCount, nextEventID);
+    }
+
+    AtomicFile out;
+    FILE *file = beginAtomicWrite(&out, EVENTS_FILE, 0);
+    if (file == NULL)
+    {
+        return 0;
+    }
+    resetEventIndex();
+    for (int i = 0; i < eventCatalogCount; i++)
+    {
+        const EventRecord *ev = &eventCatalog[i];
+        addEventIndexEntry(ftell(file));
+        fprintf(file, "%d|%s|%s|%s|%s|%d\n", ev->id, ev->name, ev->venue, ev->date, ev->time, ev->seatCapacity);
+    }
+    if (!commitAtomicWrite(&out))
+    {
+        return 0;
+    }
+    saveEventIndex();
+    return 1;
+}
+
+/**
+ * Rewrite events.txt (or events.bin) from the catalog.
+ * Returns 1 on success, 0 if the file could not be written.
+ */
+int saveEventCatalog()
+{
+    return deferWrite(writeEventCatalog);
+}
+
+// Number of events currently in the catalog
+int getEventCount()
+{
+    if (!eventCatalogLoaded) loadEventCatalog();
+    return eventCatalogCount;
+}
+
+// Returns the event at a 0-based list position, or NULL if out of range
+const EventRecord* getEventAt(int position)
+{
+    if (!eventCatalogLoaded) loadEventCatalog();
+    if (position < 0 || position >= eventCatalogCount) return NULL;
+    return &eventCatalog[position];
+}
+
+// Returns the event with the given persistent ID, or NULL if there is none
+const EventRecord* getEventByID(int eventID)
+{
+    if (!eventCatalogLoaded) loadEventCatalog();
+    if (eventID < 1 || eventID >= eventSlotCount) return NULL;
+    int position = eventSlotByID[eventID];
+    return (position >= 0) ? &eventCatalog[position] : NULL;
+}
+
+/**
+ * Add a new event to the catalog and append it to events.txt.
+ * The event is given the next unused ID, which is stored back into *event.
+ * Returns 1 on success, 0 on failure.
+ */
+int appendEvent(EventRecord *event)
+{
+    if (!eventCatalogLoaded) loadEventCatalog();
+    if (!reserveEventCatalog(eventCatalogCount + 1) || !setEventSlot(nextEventID, -1))
+    {
+        return 0;
+    }
+
+    event->id = nextEventID;
+    if (!isBinaryStorage())
+    {
+        FILE *file = fopen(EVENTS_FILE, "a");
+        if (file == NULL)
+        {
+            return 0;
+        }
+        fseek(file, 0, SEEK_END);
+        addEventIndexEntry(ftell(file));
+        fprintf(file, "%d|%s|%s|%s|%s|%d\n", event->id, event->name, event->venue, event->date, event->time, event->seatCapacity);
+        fclose(file);
+        saveEventIndex();
+    }
+
+    reserveEventID(event->id);
+    eventCatalog[eventCatalogCount] = *event;
+    setEventSlot(event->id, eventCatalogCount);
+    eventCatalogCount++;
+    if (isBinaryStorage())
+    {
+        // Records sit in front of the string heap, so events.bin is rewritten
+        return saveEventCatalog();
+    }
+    return 1;
+}
+
+/**
+ * Replace the event with the given ID and write the catalog back.
+ * The event keeps its ID whatever event->id holds.
+ * Returns 1 on success, 0 on failure.
+ */
+int updateEvent(int eventID, const EventRecord *event)
+{
+    if (getEventByID(eventID) == NULL) return 0;
+    int position = eventSlotByID[eventID];
+    eventCatalog[position] = *event;
+    eventCatalog[position].id = eventID;
+    return saveEventCatalog();
+}
+
+/**
+ * Remove the event with the given ID and write the catalog back.
+ * Other events keep their IDs; only their list positions move up.
+ * Returns 1 on success, 0 on failure.
+ */
+int deleteEvent(int eventID)
+{
+    if (getEventByID(eventID) == NULL) return 0;
+    int position = eventSlotByID[eventID];
+    memmove(&eventCatalog[position], &eventCatalog[position + 1],
+            (size_t)(eventCatalogCount - position - 1) * sizeof(EventRecord));
+    eventCatalogCount--;
+    eventSlotByID[eventID] = -1;
+    for (int i = position; i < eventCatalogCount; i++)
+    {
+        eventSlotByID[eventCatalog[i].id] = i;
+    }
+    return saveEventCatalog();
+}
+
+/*
+ * ========================= EVENT INDEX =========================
+ * events.idx lists the byte offset of every record in events.txt, in
+ * catalog order, and is stamped with the size and modification time of the
+ * events.txt it describes. It is rebuilt whenever the program writes
+ * events.txt or finds the stamp out of date, so a single event can be read
+ * back with one fseek, and a changed stamp tells us events.txt was edited
+ * outside the program and the catalog must be reloaded.
+ * The binary backend needs no index (records are at fixed offsets).
+ */
+
+#define EVENT_INDEX_VERSION 1
+
+typedef struct
+{
+    char magic[4];  // "EEIX"
+    uint32_t version;
+    uint64_t fileSize;
+    int64_t mtime;
+    uint32_t count;
+    uint32_t reserved;
+} EventIndexHeader;
+
+static uint32_t *eventLineOffsets = NULL;  // Catalog position -> offset of its line in events.txt
+static int eventLineOffsetCount = 0;
+static int eventLineOffsetCapacity = 0;
+static uint64_t indexedFileSize = 0;       // Stamp of the events.txt the offsets describe
+static int64_t indexedFileMtime = 0;
+
+// Size and mtime of events.txt; returns 0 if it does not exist
+static int statEventsFile(uint64_t *size, int64_t *mtime)
+{
+    struct stat st;
+    if (stat(EVENTS_FILE, &st) != 0) return 0;
+    *size = (uint64_t)st.st_size;
+    *mtime = (int64_t)st.st_mtime;
+    return 1;
+}
+
+// Forgets all offsets (the catalog is about to be reloaded or rewritten)
+void resetEventIndex()
+{
+    eventLineOffsetCount = 0;
+}
+
+// Records the offset of the next catalog position's line
+int addEventIndexEntry(long offset)
+{
+    if (eventLineOffsetCount == eventLineOffsetCapacity)
+    {
+        int newCapacity = eventLineOffsetCapacity ? eventLineOffsetCapacity * 2 : 64;
+        uint32_t *grown = realloc(eventLineOffsets, (size_t)newCapacity * sizeof(uint32_t));
+        if (grown == NULL) return 0;
+        eventLineOffsets = grown;
+        eventLineOffsetCapacity = newCapacity;
+    }
+    eventLineOffsets[eventLineOffsetCount++] = (uint32_t)offset;
+    return 1;
+}
+
+/**
+ * Stamp the offsets with the current events.txt and write events.idx,
+ * unless the file on disk already describes exactly this events.txt.
+ * Returns 1 on success, 0 on failure.
+ */
+int saveEventIndex()
+{
+    uint64_t size;
+    int64_t mtime;
+    if (!statEventsFile(&size, &mtime)) return 0;
+    indexedFileSize = size;
+    indexedFileMtime = mtime;
+
+    EventIndexHeader h;
+    FILE *file = fopen(EVENT_INDEX_FILE, "rb");
+    if (file != NULL)
+    {
+        int current = fread(&h, sizeof(h), 1, file) == 1 && memcmp(h.magic, "EEIX", 4) == 0
+                   && h.version == EVENT_INDEX_VERSION && h.fileSize == size && h.mtime == mtime
+                   && h.count == (uint32_t)eventLineOffsetCount;
+        fclose(file);
+        if (current) return 1;
+    }
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, "EEIX", 4);
+    h.version = EVENT_INDEX_VERSION;
+    h.fileSize = size;
+    h.mtime = mtime;
+    h.count = (uint32_t)eventLineOffsetCount;
+    AtomicFile out;
+    file = beginAtomicWrite(&out, EVENT_INDEX_FILE, 1);
+    if (file == NULL) return 0;
+    if (fwrite(&h, sizeof(h), 1, file) != 1
+        || fwrite(eventLineOffsets, sizeof(uint32_t), (size_t)eventLineOffsetCount, file) != (size_t)eventLineOffsetCount)
+    {
+        abortAtomicWrite(&out);
+        return 0;
+    }
+    return commitAtomicWrite(&out);
+}
+
+/**
+ * Reload the catalog if events.txt changed since it was indexed (edited by
+ * hand or by another running copy). Screens call this on entry.
+ * Returns 1 if the catalog was reloaded, 0 if it was already current.
+ */
+int refreshEventCatalog()
+{
+    if (isBinaryStorage()) return 0;
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    int exists = statEventsFile(&size, &mtime);
+    if (!exists && eventLineOffsetCount == 0) return 0;
+    if (exists && size == indexedFileSize && mtime == indexedFileMtime) return 0;
+
+    loadEventCatalog();
+    reserveBookedEventIDs(); // The reload forgot IDs that only bookings still use
+    return 1;
+}
+
+/**
+ * Read one event straight from events.txt through the index (one fseek, one
+ * line), so a detail view shows what is on disk without scanning the file.
+ * Falls back to the catalog copy with the binary backend or if the line
+ * no longer matches. Returns 1 on success, 0 if there is no such event.
+ */
+int readEventFromDisk(int eventID, EventRecord *out)
+{
+    const EventRecord *cached = getEventByID(eventID);
+    if (cached == NULL) return 0;
+    *out = *cached;
+
+    int position = eventSlotByID[eventID];
+    if (isBinaryStorage() || position >= eventLineOffsetCount) return 1;
+
+    FILE *file = fopen(EVENTS_FILE, "rb");
+    if (file == NULL) return 1;
+    char line[512];
+    EventRecord ev;
+    if (fseek(file, (long)eventLineOffsets[position], SEEK_SET) == 0 && fgets(line, sizeof(line), file))
+    {
+        StrView view = { line, (int)strcspn(line, "\n") };
+        if (parseEventLine(view, &ev) && ev.id == eventID) *out = ev;
+    }
+    fclose(file);
+    return 1;
+}
+
+/*
+ * ========================= EVENT MANAGEMENT =========================
+ */
+
+void viewEventDetailsOnly()
+{
+    Arena *arena = beginScreenArena("View Events");
+    refreshEventCatalog();
+    int eventCount = getEventCount();
+    if (eventCount == 0)
+    {
+    printNotice("No events available.", 'I');
+    printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+
+    // Build boxed list
+    StringList items;
+    stringListInit(&items, arena);
+    for (int i = 0; i < eventCount; i++) {
+        stringListAddf(&items, "%d. %s", i + 1, getEventAt(i)->name);
+    }
+    stringListAddf(&items, "%d. Return to dashboard", eventCount + 1);
+    printMenuItemsWithBoxes("Available Events", items.items, items.count);
+
+    // Get user's event selection
+    int choice;
+    char buf_input[16];
+    inputUnified("Enter event ID to view details: ", buf_input, sizeof(buf_input));
+    if (sscanf(buf_input, "%d", &choice) != 1)
+    {
+        printNotice("Invalid input.", 'W');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+    if (choice < 1 || choice > eventCount + 1)
+    {
+        printNotice("Invalid choice.", 'W');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+    if (choice == eventCount + 1)
+    {
+        clear(); // Clear screen before returning to dashboard
+        return;
+    }
+
+    // Show details for selected event (VIEW ONLY)
+    clear();
+    EventRecord detail;
+    readEventFromDisk(getEventAt(choice - 1)->id, &detail);
+    const EventRecord *ev = &detail;
+    
+    // Detail block: the return prompt below lines up with the detail lines
+    UnifiedBlock details;
+    blockInit(&details, arena);
+    blockAdd(&details, "=== Event Details ===");
+    blockAdd(&details, "");
+    blockAddf(&details, "Event ID: %d", ev->id);
+    blockAddf(&details, "Name: %s", ev->name);
+    blockAddf(&details, "Venue: %s", ev->venue);
+    blockAddf(&details, "Date (DD-MM-YYYY): %s", ev->date);
+    blockAddf(&details, "Time: %s", ev->time);
+    blockAddf(&details, "Seat Capacity: %d", ev->seatCapacity);
+    blockAdd(&details, "");
+    blockReserve(&details, "Press Enter to return to event list...");
+    printUnifiedBlock(&details);
+    
+    // Simple return prompt (NO BOOKING OPTIONS)
+    char continueBuf[10];
+    inputUnifiedBlock(&details, "Press Enter to return to event list...", continueBuf, sizeof(continueBuf));
+    
+    // Return to event list to view more events
+    clear();
+    viewEventDetailsOnly(); // Recursive call to show list again
+}
+
+void addEvent()
+{
+    Arena *arena = beginScreenArena("Add Event");
+    char name[100], venue[100], date[20], time[20];
+    int seatCapacity;
+
+    // Use unified block system for consistency: the prompts share the title's column
+    UnifiedBlock form;
+    blockInit(&form, arena);
+    blockAdd(&form, "=== Add New Event ===");
+    blockAdd(&form, "");
+    blockReserve(&form, "Event Name: ");
+    blockReserve(&form, "Venue: ");
+    blockReserve(&form, "Date (DD-MM-YYYY): ");
+    blockReserve(&form, "Time (HH:MM): ");
+    blockReserve(&form, "Seat Capacity: ");
+    printUnifiedBlock(&form);
+    
+    // Get event details with unified block positioning
+    inputUnifiedBlock(&form, "Event Name: ", name, sizeof(name));
+    inputUnifiedBlock(&form, "Venue: ", venue, sizeof(venue));
+    inputUnifiedBlock(&form, "Date (DD-MM-YYYY): ", date, sizeof(date));
+    inputUnifiedBlock(&form, "Time (HH:MM): ", time, sizeof(time));
+    char buf[16];
+    inputUnifiedBlock(&form, "Seat Capacity: ", buf, sizeof(buf));
+    
+    if (sscanf(buf, "%d", &seatCapacity) != 1)
+    {
+    printNotice("Invalid input for seat capacity.", 'W');
+    printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+
+    EventRecord ev;
+    snprintf(ev.name, sizeof(ev.name), "%s", name);
+    snprintf(ev.venue, sizeof(ev.venue), "%s", venue);
+    snprintf(ev.date, sizeof(ev.date), "%s", date);
+    snprintf(ev.time, sizeof(ev.time), "%s", time);
+    ev.seatCapacity = seatCapacity;
+    if (!appendEvent(&ev))
+    {
+        printNotice("Error opening events file!", 'E');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+    
+    printNotice("Event added successfully!", 'S');
+    printNotice("Press any key to continue...", 'I');
+    termGetKey();
+    clear(); // Clear screen after adding event
+}
+
+void adminViewAllEvents()
+{
+    Arena *arena = beginScreenArena("Admin Events");
+    refreshEventCatalog();
+    int eventCount = getEventCount();
+    int newSeatCapacity;
+    if (eventCount == 0)
+    {
+    printNotice("No events found.", 'I');
+    printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+    // Render boxed list
+    StringList items;
+    stringListInit(&items, arena);
+    for (int i = 0; i < eventCount; i++)
+    {
+        stringListAddf(&items, "%d. %s", i + 1, getEventAt(i)->name);
+    }
+    stringListAddf(&items, "%d. Return to admin menu", eventCount + 1);
+    printMenuItemsWithBoxes("All Events", items.items, items.count);
+
+    int choice;
+    const char *selectPrompt = arenaStrf(arena, "Select an event to view/edit/delete or %d to return: ", eventCount + 1);
+    char buf[16];
+    inputUnified(selectPrompt, buf, sizeof(buf));
+    if (sscanf(buf, "%d", &choice) != 1)
+    {
+    printNotice("Invalid input.", 'W');
+    printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+    if (choice < 1 || choice > eventCount + 1)
+    {
+    printNotice("Invalid choice.", 'W');
+    printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+    if (choice == eventCount + 1)
+    {
+        clear(); // Clear screen before returning to admin dashboard
+        return;
+    }
+
+    // Show details for selected event (copy, since edits replace the catalog entry)
+    clear();
+    EventRecord current = *getEventAt(choice - 1);
+    const char *name = current.name, *venue = current.venue, *date = current.date, *time = current.time;
+    int seatCapacity = current.seatCapacity;
+    
+    // Detail block; the edit prompts below reuse its column
+    UnifiedBlock details;
+    blockInit(&details, arena);
+    blockAdd(&details, "=== Event Details ===");
+    blockAdd(&details, "");
+    blockAddf(&details, "Event ID: %d", current.id);
+    blockAddf(&details, "Name: %s", name);
+    blockAddf(&details, "Venue: %s", venue);
+    blockAddf(&details, "Date (DD-MM-YYYY): %s", date);
+    blockAddf(&details, "Time: %s", time);
+    blockAddf(&details, "Seat Capacity: %d", seatCapacity);
+    blockAdd(&details, "");
+    printUnifiedBlock(&details);
+    {
+        const char *evtMenu2[] = {
+            "1. Edit Event",
+            "2. Delete Event",
+            "3. Return"
+        };
+        printMenuItemsWithBoxes("Actions", evtMenu2, 3);
+    }
+    
+    int action;
+    char buf2[16];
+    inputUnified("Select an option: ", buf2, sizeof(buf2));
+    if (sscanf(buf2, "%d", &action) != 1)
+    {
+    printNotice("Invalid input.", 'W');
+        return;
+    }
+
+    if (action == 1)
+    {
+        // Edit event
+        clear();
+        char newName[100], newVenue[100], newDate[20], newTime[20];
+        const char *promptName = arenaStrf(arena, "Enter new event name (or press Enter to keep '%s'): ", name);
+        inputUnifiedBlock(&details, promptName, newName, sizeof(newName));
+        if (strlen(newName) == 0)
+            strcpy(newName, name);
+
+        const char *promptVenue = arenaStrf(arena, "Enter new venue (or press Enter to keep '%s'): ", venue);
+        inputUnifiedBlock(&details, promptVenue, newVenue, sizeof(newVenue));
+        if (strlen(newVenue) == 0)
+            strcpy(newVenue, venue);
+
+        const char *promptDate = arenaStrf(arena, "Enter new date (DD-MM-YYYY) (or press Enter to keep '%s'): ", date);
+        inputUnifiedBlock(&details, promptDate, newDate, sizeof(newDate));
+        if (strlen(newDate) == 0)
+            strcpy(newDate, date);
+
+        const char *promptTime = arenaStrf(arena, "Enter new time (or press Enter to keep '%s'): ", time);
+        inputUnifiedBlock(&details, promptTime, newTime, sizeof(newTime));
+        if (strlen(newTime) == 0)
+            strcpy(newTime, time);
+
+        const char *promptSeat = arenaStrf(arena, "Enter new seat capacity (or 0 to keep %d): ", seatCapacity);
+        char buf3[16];
+        inputUnifiedBlock(&details, promptSeat, buf3, sizeof(buf3));
+        if (sscanf(buf3, "%d", &newSeatCapacity) != 1 || newSeatCapacity <= 0)
+            newSeatCapacity = seatCapacity;
+
+        EventRecord updated;
+        snprintf(updated.name, sizeof(updated.name), "%s", newName);
+        snprintf(updated.venue, sizeof(updated.venue), "%s", newVenue);
+        snprintf(updated.date, sizeof(updated.date), "%s", newDate);
+        snprintf(updated.time, sizeof(updated.time), "%s", newTime);
+        updated.seatCapacity = newSeatCapacity;
+        if (!updateEvent(current.id, &updated))
+        {
+            printNotice("Error updating events file!", 'E');
+            return;
+        }
+        
+    printNotice("Event updated successfully!", 'S');
+    printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        clear(); // Clear screen after event update
+    }
+    else if (action == 2)
+    {
+        // Delete event and cascade to its bookings; one catalog rewrite and at most one compaction
+        beginWriteBatch();
+        int deleted = deleteEvent(current.id);
+        int removedBookings = deleted ? removeBookingsByEventID(current.id) : 0;
+        if (!endWriteBatch() || !deleted)
+        {
+            printNotice("Error updating events file!", 'E');
+            return;
+        }
+
+        clear();
+    printNotice("Event deleted successfully!", 'S');
+        if (removedBookings > 0)
+        {
+            printNotice(arenaStrf(arena, "Also removed %d booked seat(s) for this event.", removedBookings), 'I');
+        }
+    printNotice("Press any key to continue...", 'I');
+        termGetKey();
+    }
+    else
+    {
+        clear();
+        return;
+    }
+}
+
+/**
+ * Admin function to view all registered users
+ */
+void viewAllUsers()
+{
+    Arena *arena = beginScreenArena("View Users");
+    RecordFile file;
+    if (!openRecordFile(&file, USER_INFO_FILE))
+    {
+        boxBordered("No users found.", visualLen("No users found.") + 2);
+        printUnified("");
+    printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+
+    StrView line;
+    long long ticketCode;
+    char name[100], ticketText[16];
+    // Build boxed list of users
+    StringList items;
+    stringListInit(&items, arena);
+    while (nextRecordLine(&file, &line))
+    {
+        if (parseUserLine(line, &ticketCode, name, sizeof(name)))
+        {
+            formatTicketCode(ticketCode, ticketText, sizeof(ticketText));
+            stringListAddf(&items, "%s | %s", ticketText, name);
+        }
+    }
+    closeRecordFile(&file);
+    if (items.count == 0)
+    {
+        boxBordered("No users found.", visualLen("No users found.") + 2);
+        printUnified("");
+    printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+    printMenuItemsWithBoxes("All Registered Users", items.items, items.count);
+
+    printNotice(arenaStrf(arena, "%d of %d 4-digit ticket codes still available.", ticketCodesAvailable(), TICKET_CODE_SPACE), 'I');
+
+    // Centered continue prompt
+    char continueBuf[10];
+    inputUnified("Press Enter to continue...", continueBuf, sizeof(continueBuf));
+    clear();
+}
+
+/**
+ * Admin: Remove a user by entering their ticket code or their name.
+ * Also removes all bookings for that user.
+ */
+void removeUser()
+{
+    Arena *arena = beginScreenArena("Remove User");
+    // Load users
+    RecordFile file;
+    if (!openRecordFile(&file, USER_INFO_FILE))
+    {
+        boxBordered("No users found.", visualLen("No users found.") + 2);
+        printUnified("");
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+
+    typedef struct { long long ticket; char name[100]; } UserEntry;
+    Vector userList;
+    vectorInit(&userList, sizeof(UserEntry));
+    UserEntry entry;
+    StrView line;
+    while (nextRecordLine(&file, &line))
+    {
+        if (parseUserLine(line, &entry.ticket, entry.name, sizeof(entry.name)))
+        {
+            UserEntry *slot = vectorPush(&userList);
+            if (slot == NULL) break;
+            *slot = entry;
+        }
+    }
+    closeRecordFile(&file);
+
+    UserEntry *users = userList.data;
+    int count = userList.count;
+    if (count == 0)
+    {
+        vectorFree(&userList);
+        boxBordered("No users found.", visualLen("No users found.") + 2);
+        printUnified("");
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
+
+    // Build boxed list like others
+    StringList items;
+    stringListInit(&items, arena);
+    char ticketText[16];
+    for (int i = 0; i < count; i++)
+    {
+        formatTicketCode(users[i].ticket, ticketText, sizeof(ticketText));
+        stringListAddf(&items, "%s | %s", ticketText, users[i].name);
+    }
+    printMenuItemsWithBoxes("All Registered Users", items.items, items.count);
+
+    // Prompt for input with ability to cancel
+    char input[128];
+    inputUnified("Enter ticket code or user name to remove (or press Enter to cancel): ", input, sizeof(input));
+    if (strlen(input) == 0)
+    {
+        printNotice("Removal canceled.", 'I');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        clear();
+        vectorFree(&userList);
+        return;
+    }
+
+    // Resolve selection: ticket code first, then name (an 8-letter name can look like a code)
+    long long targetTicket = parseTicketCode(input);
+    int targetIndex = -1;
+
+    for (int i = 0; i < count && targetTicket >= 0; i++)
+    {
+        if (users[i].ticket == targetTicket) { targetIndex = i; break; }
+    }
+    for (int i = 0; i < count && targetIndex == -1; i++)
+    {
+        if (equalsIgnoreCase(users[i].name, input)) { targetIndex = i; break; }
+    }
+
+    if (targetIndex == -1)
+    {
+        printNotice("No matching user found.", 'I');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        clear();
+        vectorFree(&userList);
+        return;
+    }
+
+    // Confirmation block using unified block style
+    formatTicketCode(users[targetIndex].ticket, ticketText, sizeof(ticketText));
+    UnifiedBlock confirmBlock;
+    blockInit(&confirmBlock, arena);
+    blockAdd(&confirmBlock, "Confirm User Deletion");
+    blockAdd(&confirmBlock, "");
+    blockAddf(&confirmBlock, "Ticket: %s", ticketText);
+    blockAddf(&confirmBlock, "Name: %s", users[targetIndex].name);
+    blockAdd(&confirmBlock, "");
+    blockReserve(&confirmBlock, "Type YES to confirm deletion (anything else to cancel)");
+    printUnifiedBlock(&confirmBlock);
+    char confirm[16];
+    inputUnifiedBlock(&confirmBlock, "Type YES to confirm: ", confirm, sizeof(confirm));
+
+    if (!(equalsIgnoreCase(confirm, "YES")))
+    {
+        printNotice("Deletion canceled.", 'I');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        clear();
+        vectorFree(&userList);
+        return;
+    }
+
+    // Rewrite users excluding the target
+    int current = userFileStampCurrent();
+    AtomicFile userFile;
+    FILE *out = beginAtomicWrite(&userFile, USER_INFO_FILE, 0);
+    if (out == NULL)
+    {
+        printNotice("Error opening temp file.", 'E');
+        vectorFree(&userList);
+        return;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        if (i == targetIndex) continue;
+        formatTicketCode(users[i].ticket, ticketText, sizeof(ticketText));
+        fprintf(out, "%s,%s\n", ticketText, users[i].name);
+    }
+    if (!commitAtomicWrite(&userFile))
+    {
+        printNotice("Error updating user file!", 'E');
+        vectorFree(&userList);
+        return;
+    }
+    unindexUser(users[targetIndex].ticket);
+    if (current) stampUserFile();
+
+    // Cascade delete bookings; any compaction they trigger runs once at the end
+    beginWriteBatch();
+    int removedBookings = removeBookingsByUserName(users[targetIndex].name);
+    endWriteBatch();
+
+    printNotice("User removed successfully.", 'S');
+    if (removedBookings > 0)
+    {
+        printNotice(arenaStrf(arena, "Also removed %d booked seat(s) for this user.", removedBookings), 'I');
+    }
+    vectorFree(&userList);
+    printNotice("Press any key to continue...", 'I');
+    termGetKey();
+    clear();
+}
+
+/*
+ * ========================= SEAT INVENTORY =========================
+ * Live booked-seat count per event, indexed directly by event ID. The
+ * booking journal updates it whenever a booking is added or cancelled, so
+ * checking whether an event still has a free seat is O(1).
+ */
+
+static int *eventBookedSeats = NULL;
+static int eventBookedSlots = 0;
+
+// Makes sure eventBookedSeats has a slot for eventID (only IDs isValidEventID accepts)
+static int reserveSeatCounter(int eventID)
+{
+    if (!isValidEventID(eventID)) return 0;
+    if (eventID < eventBookedSlots) return 1;
+    int newSlots = eventBookedSlots ? eventBookedSlots : 64;
+    while (newSlots <= eventID) newSlots *= 2;  // Stays below 2 * MAX_EVENT_ID
+    int *grown = realloc(eventBookedSeats, (size_t)newSlots * sizeof(int));
+    if (grown == NULL) return 0;
+    memset(grown + eventBookedSlots, 0, (size_t)(newSlots - eventBookedSlots) * sizeof(int));
+    eventBookedSeats = grown;
+    eventBookedSlots = newSlots;
+    return 1;
+}
+
+// Clears every counter (before the journal is replayed)
+void resetSeatInventory()
+{
+    if (eventBookedSeats) memset(eventBookedSeats, 0, (size_t)eventBookedSlots * sizeof(int));
+}
+
+// Adjusts the booked count for an event by delta (+1 on booking, -1 on cancellation)
+void adjustBookedSeats(int eventID, int delta)
+{
+    if (eventID < 0 || !reserveSeatCounter(eventID)) return;
+    eventBookedSeats[eventID] += delta;
+}
+
+// Seats currently booked for an event
+int getBookedSeats(int eventID)
+{
+    if (eventID < 0 || eventID >= eventBookedSlots) return 0;
+    return eventBookedSeats[eventID];
+}
+
+// Seats still free for an event (0 if the event is full or does not exist)
+int getSeatsRemaining(int eventID)
+{
+    const EventRecord *ev = getEventByID(eventID);
+    if (ev == NULL) return 0;
+    int remaining = ev->seatCapacity - getBookedSeats(eventID);
+    return (remaining > 0) ? remaining : 0;
+}
+
+/*
+ * ========================= BOOKING JOURNAL =========================
+ * bookings.txt is an append-only journal. A booking is written as
+ * "EventID Name"; a cancellation appends a tombstone "-EventID Name" that
+ * cancels one of that user's seats for that event. Either may carry a seat
+ * count ("EventID*Quantity Name"). Replaying the journal at startup rebuilds
+ * the live bookings in memory, and the file is compacted (rewritten with live
+ * bookings only, one line per user and event) once tombstones outnumber them.
+ *
+ * Each (event, user) pair has at most one record, which counts the seats held.
+ * An open-addressing set keyed by the pair finds it in O(1), so a repeat
+ * booking is detected (and adds a seat) instead of becoming a duplicate line.
+ *
+ * A user -> bookings multimap sits on top of the records: an open-addressing
+ * table keyed by name points at the user's oldest record, and each record
+ * links to the user's next one. Per-user listings and cancellation walk only
+ * that chain. Cancelled records stay linked (skipped on the walk) until the
+ * next compaction rebuilds the chains.
+ *
+ * An event -> bookings chain works the same way, except that event IDs are
+ * small and dense, so its heads are indexed directly by ID (like the seat
+ * counters). Deleting an event walks only that event's bookings.
+ *
+ * Another instance may append to the journal while this one runs. The
+ * journal is stamped (size and mtime, as events.idx stamps events.txt) when
+ * it is loaded and after each of our own appends. If an append finds the
+ * stamp out of date, the record is also remembered in journalOwnTail. Before
+ * compaction rewrites the file, the records past the last stamp are read
+ * back: the ones in journalOwnTail are already applied, and the others are
+ * replayed, so compaction never drops another instance's bookings.
+ */
+
+#define JOURNAL_COMPACT_MIN 64  // Don't bother compacting tiny journals
+
+static BookingRecord *bookingRecords = NULL;
+static int bookingRecordCount = 0;     // Records in memory, live or cancelled
+static int bookingRecordCapacity = 0;
+static int bookingLiveCount = 0;
+static int bookingTombstoneCount = 0;  // Tombstone lines currently in bookings.txt
+static int *userBookingHeads = NULL;   // Hash slot -> user's oldest record, or USER_SLOT_EMPTY
+static int *userBookingTails = NULL;   // Hash slot -> user's newest record
+static int userBookingSlotCount = 0;   // Always a power of two
+static int userBookingKeys = 0;        // Distinct names in the table
+static int *pairBookingSlots = NULL;   // Hash slot -> record of an (event, user) pair, or USER_SLOT_EMPTY
+static int pairBookingSlotCount = 0;   // Always a power of two
+static int *eventBookingHeads = NULL;  // Event ID -> event's oldest record, or -1
+static int *eventBookingTails = NULL;  // Event ID -> event's newest record
+static int eventBookingSlots = 0;
+static int journalSyncedCount = 0;     // Journal records already applied in memory
+static uint64_t journalStampSize = 0;  // Journal size and mtime when journalSyncedCount was right
+static int64_t journalStampMtime = 0;
+static Vector journalOwnTail = { NULL, 0, 0, sizeof(BookingRecord) };  // Our appends since the stamp went stale
+
+static unsigned int hashBookingPair(int eventID, const char *name)
+{
+    return hashUserName(name) * 31U + hashTicketCode(eventID);
+}
+
+// Returns the slot holding (eventID, name), or the empty slot where it belongs
+static int findPairSlot(int eventID, const char *name)
+{
+    unsigned int mask = (unsigned int)pairBookingSlotCount - 1;
+    unsigned int i = hashBookingPair(eventID, name) & mask;
+    while (pairBookingSlots[i] != USER_SLOT_EMPTY)
+    {
+        const BookingRecord *b = &bookingRecords[pairBookingSlots[i]];
+        if (b->eventID == eventID && strcmp(b->name, name) == 0) break;
+        i = (i + 1) & mask;
+    }
+    return (int)i;
+}
+
+/**
+ * Rebuild the (event, user) set for the current records, sized for at least
+ * `needed` records. Records are one per pair, so no two collide on a key.
+ * Returns 1 on success, 0 if memory ran out.
+ */
+static int rebuildPairBookingSet(int needed)
+{
+    int size = 64;
+    while (size < needed * 2) size *= 2;
+    int *slots = malloc((size_t)size * sizeof(int));
+    if (slots == NULL) return 0;
+    for (int i = 0; i < size; i++) slots[i] = USER_SLOT_EMPTY;
+
+    free(pairBookingSlots);
+    pairBookingSlots = slots;
+    pairBookingSlotCount = size;
+    for (int i = 0; i < bookingRecordCount; i++)
+    {
+        pairBookingSlots[findPairSlot(bookingRecords[i].eventID, bookingRecords[i].name)] = i;
+    }
+    return 1;
+}
+
+// Record of the (eventID, name) pair, live or cancelled, or -1
+static int findBookingPair(int eventID, const char *name)
+{
+    if (pairBookingSlotCount == 0) return -1;
+    int record = pairBookingSlots[findPairSlot(eventID, name)];
+    return (record == USER_SLOT_EMPTY) ? -1 : record;
+}
+
+// Seats name currently holds for eventID (0 if none); O(1)
+int getBookedQuantity(int eventID, const char *name)
+{
+    int index = findBookingPair(eventID, name);
+    return (index >= 0 && bookingRecords[index].active) ? bookingRecords[index].quantity : 0;
+}
+
+// Returns the slot holding name's chain, or the empty slot where it belongs
+static int findUserBookingSlot(const char *name)
+{
+    unsigned int mask = (unsigned int)userBookingSlotCount - 1;
+    unsigned int i = hashUserName(name) & mask;
+    while (userBookingHeads[i] != USER_SLOT_EMPTY && strcmp(bookingRecords[userBookingHeads[i]].name, name) != 0)
+    {
+        i = (i + 1) & mask;
+    }
+    return (int)i;
+}
+
+// Appends record `index` to the end of its user's chain
+static void linkUserBooking(int index)
+{
+    int slot = findUserBookingSlot(bookingRecords[index].name);
+    bookingRecords[index].nextForUser = -1;
+    if (userBookingHeads[slot] == USER_SLOT_EMPTY)
+    {
+        userBookingHeads[slot] = index;
+        userBookingKeys++;
+    }
+    else
+    {
+        bookingRecords[userBookingTails[slot]].nextForUser = index;
+    }
+    userBookingTails[slot] = index;
+}
+
+/**
+ * Rebuild the user -> bookings table for the current records with room for
+ * at least `needed` distinct names. Called after loading and compaction
+ * (which renumber records) and when the table fills up.
+ * Returns 1 on success, 0 if memory ran out.
+ */
+static int rebuildUserBookingIndex(int needed)
+{
+    int size = 64;
+    while (size < needed * 2) size *= 2;
+    int *heads = malloc((size_t)size * sizeof(int));
+    int *tails = malloc((size_t)size * sizeof(int));
+    if (heads == NULL || tails == NULL)
+    {
+        free(heads);
+        free(tails);
+        return 0;
+    }
+    for (int i = 0; i < size; i++) heads[i] = USER_SLOT_EMPTY;
+
+    free(userBookingHeads);
+    free(userBookingTails);
+    userBookingHeads = heads;
+    userBookingTails = tails;
+    userBookingSlotCount = size;
+    userBookingKeys = 0;
+    for (int i = 0; i < bookingRecordCount; i++) linkUserBooking(i);
+    return 1;
+}
+
+// Appends record `index` to the end of its event's chain
+static int linkEventBooking(int index)
+{
+    int eventID = bookingRecords[index].eventID;
+    if (!isValidEventID(eventID)) return 0;
+    if (eventID >= eventBookingSlots)
+    {
+        int newSlots = eventBookingSlots ? eventBookingSlots : 64;
+        while (newSlots <= eventID) newSlots *= 2;  // Stays below 2 * MAX_EVENT_ID
+        // Grow both arrays before switching to either, so they never differ in size
+        int *heads = malloc((size_t)newSlots * sizeof(int));
+        int *tails = malloc((size_t)newSlots * sizeof(int));
+        if (heads == NULL || tails == NULL)
+        {
+            free(heads);
+            free(tails);
+            return 0;
+        }
+        if (eventBookingSlots > 0)
+        {
+            memcpy(heads, eventBookingHeads, (size_t)eventBookingSlots * sizeof(int));
+            memcpy(tails, eventBookingTails, (size_t)eventBookingSlots * sizeof(int));
+        }
+        for (int i = eventBookingSlots; i < newSlots; i++) heads[i] = -1;
+        free(eventBookingHeads);
+        free(eventBookingTails);
+        eventBookingHeads = heads;
+        eventBookingTails = tails;
+        eventBookingSlots = newSlots;
+    }
+
+    bookingRecords[index].nextForEvent = -1;
+    if (eventBookingHeads[eventID] < 0)
+    {
+        eventBookingHeads[eventID] = index;
+    }
+    else
+    {
+        bookingRecords[eventBookingTails[eventID]].nextForEvent = index;
+    }
+    eventBookingTails[eventID] = index;
+    return 1;
+}
+
+// Rebuilds every event chain for the current records (after loading and compaction)
+static void rebuildEventBookingIndex()
+{
+    for (int i = 0; i < eventBookingSlots; i++) eventBookingHeads[i] = -1;
+    for (int i = 0; i < bookingRecordCount; i++) linkEventBooking(i);
+}
+
+// Index of the event's oldest booking record (live or cancelled), or -1
+int firstBookingOfEvent(int eventID)
+{
+    if (eventID < 0 || eventID >= eventBookingSlots) return -1;
+    return eventBookingHeads[eventID];
+}
+
+// Next record of the same event after `index`, or -1
+int nextBookingOfEvent(int index)
+{
+    return bookingRecords[index].nextForEvent;
+}
+
+// Index of the user's oldest booking record (live or cancelled), or -1
+int firstBookingOfUser(const char *name)
+{
+    if (userBookingSlotCount == 0) return -1;
+    int head = userBookingHeads[findUserBookingSlot(name)];
+    return (head == USER_SLOT_EMPTY) ? -1 : head;
+}
+
+// Next record of the same user after `index`, or -1
+int nextBookingOfUser(int index)
+{
+    return bookingRecords[index].nextForUser;
+}
+
+const BookingRecord* getBookingRecord(int index)
+{
+    return &bookingRecords[index];
+}
+
+// Writes one bookings.txt line; the seat count is only spelled out when above one
+static void writeJournalLine(FILE *file, int eventID, int quantity, const char *name)
+{
+    if (quantity > 1) fprintf(file, "%d*%d %s\n", eventID, quantity, name);
+    else fprintf(file, "%d %s\n", eventID, name);
+}
+
+// Size and mtime of the active journal file; returns 0 if it does not exist
+static int statJournalFile(uint64_t *size, int64_t *mtime)
+{
+    struct stat st;
+    if (stat(isBinaryStorage() ? BOOKINGS_BIN_FILE : BOOKINGS_FILE, &st) != 0) return 0;
+    *size = (uint64_t)st.st_size;
+    *mtime = (int64_t)st.st_mtime;
+    return 1;
+}
+
+// Records that the journal on disk holds exactly `count` records, all applied
+static void stampJournal(int count)
+{
+    journalSyncedCount = count;
+    journalOwnTail.count = 0;
+    if (!statJournalFile(&journalStampSize, &journalStampMtime))
+    {
+        journalStampSize = 0;
+        journalStampMtime = 0;
+    }
+}
+
+// 1 if nobody but us has written the journal since it was stamped
+static int journalStampCurrent()
+{
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    statJournalFile(&size, &mtime);
+    return size == journalStampSize && mtime == journalStampMtime;
+}
+
+// 1 if a journal record's event ID (negative for a tombstone) is in range
+static int isValidJournalEventID(int eventID)
+{
+    return isValidEventID(eventID) || (eventID < 0 && eventID >= -MAX_EVENT_ID);
+}
+
+// Appends one journal line; a negative eventID writes a tombstone
+static int appendJournalLine(int eventID, int quantity, const char *name)
+{
+    int current = journalOwnTail.count == 0 && journalStampCurrent();
+    if (isBinaryStorage())
+    {
+        if (!appendBookingBinary(eventID, quantity, name)) return 0;
+    }
+    else
+    {
+        FILE *file = fopen(BOOKINGS_FILE, "a");
+        if (file == NULL)
+        {
+            return 0;
+        }
+        writeJournalLine(file, eventID, quantity, name);
+        fclose(file);
+    }
+
+    if (current)
+    {
+        stampJournal(journalSyncedCount + 1);
+        return 1;
+    }
+    // Someone else appended too: remember ours so the replay can tell them apart
+    BookingRecord *own = vectorPush(&journalOwnTail);
+    if (own != NULL)
+    {
+        own->eventID = eventID;
+        own->quantity = quantity;
+        snprintf(own->name, sizeof(own->name), "%s", name);
+    }
+    return 1;
+}
+
+/**
+ * Add seats to name's booking for eventID in memory (does not touch the file).
+ * A repeat booking of the same pair grows the existing record.
+ */
+static int addBookingRecord(int eventID, const char *name, int quantity)
+{
+    int existing = findBookingPair(eventID, name);
+    if (existing >= 0)
+    {
+        BookingRecord *b = &bookingRecords[existing];
+        if (!b->active)
+        {
+            b->active = 1;
+            b->quantity = 0;
+            bookingLiveCount++;
+        }
+        b->quantity += quantity;
+        adjustBookedSeats(eventID, quantity);
+        return 1;
+    }
+
+    if (bookingRecordCount + 1 > bookingRecordCapacity)
+    {
+        int newCapacity = bookingRecordCapacity ? bookingRecordCapacity * 2 : 64;
+        BookingRecord *grown = realloc(bookingRecords, (size_t)newCapacity * sizeof(BookingRecord));
+        if (grown == NULL) return 0;
+        bookingRecords = grown;
+        bookingRecordCapacity = newCapacity;
+    }
+    BookingRecord *b = &bookingRecords[bookingRecordCount++];
+    b->eventID = eventID;
+    snprintf(b->name, sizeof(b->name), "%s", name);
+    b->quantity = quantity;
+    b->active = 1;
+    bookingLiveCount++;
+    adjustBookedSeats(eventID, quantity);
+
+    if (bookingRecordCount * 2 > pairBookingSlotCount)
+    {
+        rebuildPairBookingSet(bookingRecordCount);
+    }
+    else
+    {
+        pairBookingSlots[findPairSlot(eventID, b->name)] = bookingRecordCount - 1;
+    }
+
+    if ((userBookingKeys + 1) * 2 > userBookingSlotCount)
+    {
+        rebuildUserBookingIndex(userBookingKeys + 1); // Links the new record too
+    }
+    else
+    {
+        linkUserBooking(bookingRecordCount - 1);
+    }
+    linkEventBooking(bookingRecordCount - 1);
+    return 1;
+}
+
+// Returns the index of name's live booking for eventID, or -1
+static int findLiveBooking(int eventID, const char *name)
+{
+    int index = findBookingPair(eventID, name);
+    return (index >= 0 && bookingRecords[index].active) ? index : -1;
+}
+
+// Cancels up to `quantity` seats of a booking in memory
+static void cancelBookingRecord(int index, int quantity)
+{
+    BookingRecord *b = &bookingRecords[index];
+    if (quantity > b->quantity) quantity = b->quantity;
+    b->quantity -= quantity;
+    adjustBookedSeats(b->eventID, -quantity);
+    if (b->quantity == 0)
+    {
+        b->active = 0;
+        bookingLiveCount--;
+    }
+}
+
+// Re-reserves every event ID that a live or cancelled booking refers to
+void reserveBookedEventIDs()
+{
+    for (int i = 0; i < bookingRecordCount; i++)
+    {
+        reserveEventID(bookingRecords[i].eventID);
+    }
+}
+
+/**
+ * Read every journal record from bookings.txt (binary 0) or bookings.bin
+ * (binary 1) into a Vector of BookingRecord; tombstones keep their negative ID.
+ * Returns 1 on success, 2 if bookings.bin is in an older version, 0 if the
+ * file is missing, -1 if it is corrupt.
+ */
+int readJournalEntries(int binary, Vector *entries)
+{
+    if (binary)
+    {
+        return readBookingsBinary(entries);
+    }
+
+    RecordFile file;
+    if (!openRecordFile(&file, BOOKINGS_FILE))
+    {
+        return 0;
+    }
+
+    StrView line;
+    int eventID, quantity;
+    StrView fields[2], key[2];
+    while (nextRecordLine(&file, &line))
+    {
+        if (splitRecord(line, ' ', fields, 2) != 2) continue;
+        while (fields[1].len > 0 && *fields[1].ptr == ' ')
+        {
+            fields[1].ptr++; // "%d %s" used to skip any run of spaces
+            fields[1].len--;
+        }
+        // "EventID" or "EventID*Quantity"
+        quantity = 1;
+        if (splitRecord(fields[0], '*', key, 2) == 2 && (!viewToInt(key[1], &quantity) || quantity <= 0)) continue;
+        if (!viewToInt(key[0], &eventID) || !isValidJournalEventID(eventID) || fields[1].len == 0) continue;
+        BookingRecord *entry = vectorPush(entries);
+        if (entry == NULL) break;
+        entry->eventID = eventID;
+        entry->quantity = quantity;
+        viewCopy(fields[1], entry->name, sizeof(entry->name));
+    }
+    closeRecordFile(&file);
+    return 1;
+}
+
+// Applies one journal record (a booking or a tombstone) to the records in memory
+static void replayJournalEntry(const BookingRecord *entry)
+{
+    if (entry->eventID < 0)
+    {
+        int index = findLiveBooking(-entry->eventID, entry->name);
+        if (index >= 0) cancelBookingRecord(index, entry->quantity);
+        bookingTombstoneCount++;
+    }
+    else
+    {
+        addBookingRecord(entry->eventID, entry->name, entry->quantity);
+        reserveEventID(entry->eventID); // Never hand a booked ID to a new event
+    }
+}
+
+/**
+ * Bring memory up to date with records other instances appended to the
+ * journal since it was stamped. A journal that shrank was rewritten by
+ * another instance and is reloaded whole. Screens that show or sell seats
+ * call this on entry, and saveBooking right before its capacity check.
+ * Returns 1 on success, 0 if the journal could not be read.
+ */
+int syncBookingJournal()
+{
+    if (journalOwnTail.count == 0 && journalStampCurrent()) return 1;
+
+    Vector entries;
+    vectorInit(&entries, sizeof(BookingRecord));
+    int result = readJournalEntries(isBinaryStorage(), &entries);
+    uint64_t size = 0;
+    int64_t mtime = 0;
+    statJournalFile(&size, &mtime);
+    if (result < 0 || entries.count < journalSyncedCount || size < journalStampSize)
+    {
+        vectorFree(&entries);
+        if (result < 0) return 0;
+        loadBookingJournal();
+        return 1;
+    }
+
+    int own = 0;
+    for (int i = journalSyncedCount; i < entries.count; i++)
+    {
+        const BookingRecord *entry = vectorAt(&entries, i);
+        const BookingRecord *mine = (own < journalOwnTail.count) ? vectorAt(&journalOwnTail, own) : NULL;
+        if (mine != NULL && mine->eventID == entry->eventID && mine->quantity == entry->quantity
+            && strcmp(mine->name, entry->name) == 0)
+        {
+            own++;  // Our own append, already applied
+            continue;
+        }
+        replayJournalEntry(entry);
+    }
+    stampJournal(entries.count);
+    vectorFree(&entries);
+    return 1;
+}
+
+/**
+ * Replay the booking journal into memory. The first start on the binary
+ * backend imports bookings.txt into a new bookings.bin.
+ * Returns the number of live bookings.
+ */
+int loadBookingJournal()
+{
+    bookingRecordCount = 0;
+    bookingLiveCount = 0;
+    bookingTombstoneCount = 0;
+    resetSeatInventory();
+    rebuildUserBookingIndex(0);
+    rebuildPairBookingSet(0);
+    rebuildEventBookingIndex();
+
+    Vector entries;
+    vectorInit(&entries, sizeof(BookingRecord));
+    int result = readJournalEntries(isBinaryStorage(), &entries);
+    int imported = (result == 2); // bookings.bin in an older version: rewrite it
+    if (isBinaryStorage() && result == 0)
+    {
+        imported = readJournalEntries(0, &entries) > 0; // No bookings.bin yet: import bookings.txt
+    }
+
+    for (int i = 0; i < entries.count; i++)
+    {
+        replayJournalEntry(vectorAt(&entries, i));
+    }
+    if (imported)
+    {
+        writeBookingsBinary(BOOKINGS_BIN_FILE, entries.data, entries.count);
+    }
+    stampJournal(entries.count);
+    vectorFree(&entries);
+
+    compactBookingJournalIfNeeded();
+    return bookingLiveCount;
+}
+
+/**
+ * Rewrite bookings.txt (or bookings.bin) with live bookings only, dropping
+ * tombstones and the bookings they cancelled. Returns 1 on success, 0 on failure.
+ */
+int compactBookingJournal()
+{
+    // Pick up what other instances appended, or the rewrite would drop it
+    if (!syncBookingJournal())
+    {
+        return 0;
+    }
+
+    int live = 0;
+    for (int i = 0; i < bookingRecordCount; i++)
+    {
+        if (bookingRecords[i].active) bookingRecords[live++] = bookingRecords[i];
+    }
+    bookingRecordCount = live;
+    rebuildUserBookingIndex(userBookingKeys);
+    rebuildPairBookingSet(live);
+    rebuildEventBookingIndex();
+
+    if (isBinaryStorage())
+    {
+        if (!writeBookingsBinary(BOOKINGS_BIN_FILE, bookingRecords, live))
+        {
+            return 0;
+        }
+        bookingTombstoneCount = 0;
+        stampJournal(live);
+        return 1;
+    }
+
+    AtomicFile out;
+    FILE *file = beginAtomicWrite(&out, BOOKINGS_FILE, 0);
+    if (file == NULL)
+    {
+        return 0;
+    }
+    for (int i = 0; i < live; i++)
+    {
+        writeJournalLine(file, bookingRecords[i].eventID, bookingRecords[i].quantity, bookingRecords[i].name);
+    }
+    if (!commitAtomicWrite(&out))
+    {
+        return 0;
+    }
+
+    bookingTombstoneCount = 0;
+    stampJournal(live);
+    return 1;
+}
+
+// Deferred so a batch of cancellations compacts at most once
+static int compactIfTombstonesDominate()
+{
+    if (bookingTombstoneCount >= JOURNAL_COMPACT_MIN && bookingTombstoneCount > bookingLiveCount)
+    {
+        return compactBookingJournal();
+    }
+    return 1;
+}
+
+// Compacts once tombstones outnumber live bookings, keeping the journal at most ~2x its live size
+void compactBookingJournalIfNeeded()
+{
+    deferWrite(compactIfTombstonesDominate);
+}
+
+/*
+ * ========================= BINARY STORAGE =========================
+ * Optional binary backend selected at startup with --storage binary.
+ *
+ * events.bin    header, then one fixed 24-byte record per event, then a
+ *               string heap. Record i sits at sizeof(header) + i * 24;
+ *               names and venues are offsets into the heap. Dates
+ *               (DD-MM-YYYY) and times (HH:MM) are packed into one integer
+ *               when that round-trips exactly, otherwise kept in the heap.
+ * bookings.bin  header, then fixed 108-byte journal records until end of
+ *               file: the event ID (negative for a tombstone), the seat
+ *               count and the name. Names are stored inline so a booking
+ *               stays one append. Version 1 files had no seat count
+ *               (104-byte records); they are still read and then upgraded.
+ *
+ * Integers are stored in the host's byte order, so the files do not move
+ * between machines of different endianness; the text files do.
+ * --import-text and --export-text convert between the two backends without
+ * losing anything, tombstones included.
+ *
+ * Only a missing file is imported from the text backend. A damaged file,
+ * or one from a newer version, stops the program at startup so it is never
+ * overwritten with the older text data.
+ */
+
+#define BINARY_FORMAT_VERSION 2  // 2 added the booking seat count
+#define BINARY_PACKED 0x80000000u  // Date/time field holds a packed value, not a heap offset
+
+typedef struct
+{
+    char magic[4];         // "EEVT" or "EEBK"
+    uint32_t version;
+    uint32_t recordCount;  // events.bin only; bookings.bin runs to end of file
+    uint32_t heapSize;
+    int32_t nextEventID;
+    uint32_t reserved;
+} BinaryHeader;
+
+typedef struct
+{
+    int32_t id;
+    uint32_t name;  // Heap offsets
+    uint32_t venue;
+    uint32_t date;  // BINARY_PACKED | year << 9 | month << 5 | day, or a heap offset
+    uint32_t time;  // BINARY_PACKED | hour * 60 + minute, or a heap offset
+    int32_t seatCapacity;
+} BinaryEventRecord;
+
+typedef struct
+{
+    int32_t eventID;
+    int32_t quantity;
+    char name[100];
+} BinaryBookingRecord;
+
+typedef struct
+{
+    int32_t eventID;
+    char name[100];
+} BinaryBookingRecordV1;
+
+static int binaryStorage = 0;
+
+// Selects the binary (1) or text (0) backend for events and bookings
+void setStorageBackend(int binary)
+{
+    binaryStorage = binary;
+}
+
+int isBinaryStorage()
+{
+    return binaryStorage;
+}
+
+static uint32_t packDate(const char *date)
+{
+    int day, month, year;
+    char check[20];
+    if (sscanf(date, "%d-%d-%d", &day, &month, &year) != 3) return 0;
+    if (day < 1 || day > 31 || month < 1 || month > 12 || year < 0 || year > 9999) return 0;
+    snprintf(check, sizeof(check), "%02d-%02d-%04d", day, month, year);
+    if (strcmp(check, date) != 0) return 0; // Would not round-trip
+    return BINARY_PACKED | (uint32_t)year << 9 | (uint32_t)month << 5 | (uint32_t)day;
+}
+
+static uint32_t packTime(const char *timeText)
+{
+    int hour, minute;
+    char check[20];
+    if (sscanf(timeText, "%d:%d", &hour, &minute) != 2) return 0;
+    if (hour < 0 || hour > 23 || minute < 0 || minute > 59) return 0;
+    snprintf(check, sizeof(check), "%02d:%02d", hour, minute);
+    if (strcmp(check, timeText) != 0) return 0;
+    return BINARY_PACKED | (uint32_t)(hour * 60 + minute);
+}
+
+// Resolves a heap offset; returns NULL if it does not name a string inside the heap
+static const char* heapString(const char *heap, uint32_t heapSize, uint32_t offset)
+{
+    if (offset >= heapSize) return NULL;
+    if (memchr(heap + offset, '\0', heapSize - offset) == NULL) return NULL;
+    return heap + offset;
+}
+
+// Turns a date/time field back into text; returns 0 if it is corrupt
+static int unpackField(uint32_t field, int isDate, const char *heap, uint32_t heapSize, char *out, size_t size)
+{
+    if (field & BINARY_PACKED)
+    {
+        uint32_t v = field & ~BINARY_PACKED;
+        if (isDate) snprintf(out, size, "%02u-%02u-%04u", v & 31u, (v >> 5) & 15u, v >> 9);
+        else snprintf(out, size, "%02u:%02u", v / 60u, v % 60u);
+        return 1;
+    }
+    const char *text = heapString(heap, heapSize, field);
+    if (text == NULL) return 0;
+    snprintf(out, size, "%s", text);
+    return 1;
+}
+
+// Checks the header of a binary file held in rf
+static const BinaryHeader* binaryHeader(const RecordFile *rf, const char *magic)
+{
+    if (rf->size < sizeof(BinaryHeader)) return NULL;
+    const BinaryHeader *h = (const BinaryHeader *)rf->data;
+    if (memcmp(h->magic, magic, 4) != 0 || h->version < 1 || h->version > BINARY_FORMAT_VERSION) return NULL;
+    return h;
+}
+
+/**
+ * Read events.bin into a Vector of EventRecord.
+ * Returns 1 on success, 0 if the file is missing, -1 if it is corrupt.
+ */
+int readEventsBinary(Vector *events, int *nextID)
+{
+    RecordFile rf;
+    if (!openRecordFile(&rf, EVENTS_BIN_FILE)) return 0;
+
+    const BinaryHeader *h = binaryHeader(&rf, "EEVT");
+    size_t recordBytes = h ? (size_t)h->recordCount * sizeof(BinaryEventRecord) : 0;
+    if (h == NULL || rf.size < sizeof(BinaryHeader) + recordBytes + h->heapSize)
+    {
+        closeRecordFile(&rf);
+        return -1;
+    }
+    const char *records = rf.data + sizeof(BinaryHeader);
+    const char *heap = records + recordBytes;
+    *nextID = h->nextEventID;
+
+    int ok = 1;
+    for (uint32_t i = 0; i < h->recordCount && ok; i++)
+    {
+        BinaryEventRecord r;
+        memcpy(&r, records + (size_t)i * sizeof(r), sizeof(r)); // The mapping may be unaligned
+        EventRecord *ev = vectorPush(events);
+        const char *name = heapString(heap, h->heapSize, r.name);
+        const char *venue = heapString(heap, h->heapSize, r.venue);
+        if (ev == NULL || name == NULL || venue == NULL || r.id <= 0) { ok = 0; break; }
+        ev->id = isValidEventID(r.id) ? r.id : 0;  // 0: the loader assigns a fresh ID
+        ev->seatCapacity = r.seatCapacity;
+        snprintf(ev->name, sizeof(ev->name), "%s", name);
+        snprintf(ev->venue, sizeof(ev->venue), "%s", venue);
+        ok = unpackField(r.date, 1, heap, h->heapSize, ev->date, sizeof(ev->date))
+          && unpackField(r.time, 0, heap, h->heapSize, ev->time, sizeof(ev->time));
     }
+    closeRecordFile(&rf);
+    return ok ? 1 : -1;
 }
-/*
- * ========================= EVENT MANAGEMENT =========================
- */
 
-void viewEventDetailsOnly()
+/**
+ * Write events to events.bin (records first, then the string heap).
+ * Returns 1 on success, 0 on failure.
+ */
+int writeEventsBinary(const EventRecord *events, int count, int nextID)
 {
-    FILE *file = fopen("events.txt", "r");
-    if (file == NULL)
+    BinaryEventRecord *records = malloc((size_t)(count ? count : 1) * sizeof(BinaryEventRecord));
+    if (records == NULL) return 0;
+
+    // First pass: assign heap offsets
+    uint32_t heapSize = 0;
+    for (int i = 0; i < count; i++)
     {
-    printNotice("No events found.", 'I');
-    printNotice("Press any key to continue...", 'I');
-    getch();
-        return;
+        const EventRecord *ev = &events[i];
+        BinaryEventRecord *r = &records[i];
+        r->id = ev->id;
+        r->seatCapacity = ev->seatCapacity;
+        r->name = heapSize;  heapSize += (uint32_t)strlen(ev->name) + 1;
+        r->venue = heapSize; heapSize += (uint32_t)strlen(ev->venue) + 1;
+        r->date = packDate(ev->date);
+        if (r->date == 0) { r->date = heapSize; heapSize += (uint32_t)strlen(ev->date) + 1; }
+        r->time = packTime(ev->time);
+        if (r->time == 0) { r->time = heapSize; heapSize += (uint32_t)strlen(ev->time) + 1; }
     }
 
-    char line[300], name[100], venue[100], date[20], time[20];
-    int seatCapacity;
-    int eventCount = 0;
-    char events[50][300]; // Store up to 50 events
-
-    // First pass - collect all events
-    while (fgets(line, sizeof(line), file))
+    // Second pass: fill the heap at those offsets
+    char *heap = malloc(heapSize ? heapSize : 1);
+    if (heap == NULL)
     {
-        if (sscanf(line, "%99[^|]|%99[^|]|%19[^|]|%19[^|]|%d", name, venue, date, time, &seatCapacity) == 5)
-        {
-            eventCount++;
-            snprintf(events[eventCount - 1], sizeof(events[eventCount - 1]), "%s|%s|%s|%s|%d", name, venue, date, time, seatCapacity);
-        }
+        free(records);
+        return 0;
     }
-    fclose(file);
-    
-    if (eventCount == 0)
+    for (int i = 0; i < count; i++)
     {
-    printNotice("No events available.", 'I');
-    printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        const EventRecord *ev = &events[i];
+        const BinaryEventRecord *r = &records[i];
+        strcpy(heap + r->name, ev->name);
+        strcpy(heap + r->venue, ev->venue);
+        if (!(r->date & BINARY_PACKED)) strcpy(heap + r->date, ev->date);
+        if (!(r->time & BINARY_PACKED)) strcpy(heap + r->time, ev->time);
     }
 
-    // Build boxed list
-    char items[60][200];
-    int itemsCount = 0;
-    for (int i = 0; i < eventCount && itemsCount < 59; i++) {
-        char name[100], venue[100], date[20], time[20];
-        int seatCapacity;
-        if (sscanf(events[i], "%99[^|]|%99[^|]|%19[^|]|%19[^|]|%d", name, venue, date, time, &seatCapacity) == 5) {
-            snprintf(items[itemsCount++], sizeof(items[0]), "%d. %s", i + 1, name);
-        }
-    }
-    snprintf(items[itemsCount++], sizeof(items[0]), "%d. Return to dashboard", eventCount + 1);
-    const char *ptrs[60];
-    for (int i = 0; i < itemsCount; i++) ptrs[i] = items[i];
-    printMenuItemsWithBoxes("Available Events", ptrs, itemsCount);
-
-    // Get user's event selection
-    int choice;
-    char selectPrompt[100];
-    snprintf(selectPrompt, sizeof(selectPrompt), "Enter event ID to view details: ");
-    char buf_input[16];
-    inputUnified(selectPrompt, buf_input, sizeof(buf_input));
-    if (sscanf(buf_input, "%d", &choice) != 1)
+    BinaryHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, "EEVT", 4);
+    h.version = BINARY_FORMAT_VERSION;
+    h.recordCount = (uint32_t)count;
+    h.heapSize = heapSize;
+    h.nextEventID = nextID;
+
+    int ok = 0;
+    AtomicFile out;
+    FILE *file = beginAtomicWrite(&out, EVENTS_BIN_FILE, 1);
+    if (file != NULL)
     {
-        printNotice("Invalid input.", 'W');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        ok = fwrite(&h, sizeof(h), 1, file) == 1
+          && fwrite(records, sizeof(BinaryEventRecord), (size_t)count, file) == (size_t)count
+          && fwrite(heap, 1, heapSize, file) == heapSize;
+        if (ok) ok = commitAtomicWrite(&out);
+        else abortAtomicWrite(&out);
     }
-    if (choice < 1 || choice > eventCount + 1)
+    free(records);
+    free(heap);
+    return ok;
+}
+
+/**
+ * Read bookings.bin into a Vector of BookingRecord, one per journal record
+ * (eventID is negative for tombstones). A torn record at the end is ignored.
+ * Returns 1 on success, 0 if the file is missing, -1 if it is corrupt.
+ */
+int readBookingsBinary(Vector *entries)
+{
+    RecordFile rf;
+    if (!openRecordFile(&rf, BOOKINGS_BIN_FILE)) return 0;
+    const BinaryHeader *h = binaryHeader(&rf, "EEBK");
+    if (h == NULL)
     {
-        printNotice("Invalid choice.", 'W');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        closeRecordFile(&rf);
+        return -1;
     }
-    if (choice == eventCount + 1)
+
+    int version = (int)h->version;
+    size_t recordSize = (version == 1) ? sizeof(BinaryBookingRecordV1) : sizeof(BinaryBookingRecord);
+    size_t count = (rf.size - sizeof(BinaryHeader)) / recordSize;
+    const char *records = rf.data + sizeof(BinaryHeader);
+    for (size_t i = 0; i < count; i++)
     {
-        clear(); // Clear screen before returning to dashboard
-        return;
+        BinaryBookingRecord r;
+        if (version == 1)
+        {
+            BinaryBookingRecordV1 old;
+            memcpy(&old, records + i * recordSize, sizeof(old));
+            r.eventID = old.eventID;
+            r.quantity = 1;
+            memcpy(r.name, old.name, sizeof(r.name));
+        }
+        else
+        {
+            memcpy(&r, records + i * recordSize, sizeof(r));
+        }
+        r.name[sizeof(r.name) - 1] = '\0';
+        if (!isValidJournalEventID(r.eventID) || r.quantity <= 0 || r.name[0] == '\0') continue;
+        BookingRecord *entry = vectorPush(entries);
+        if (entry == NULL) break;
+        entry->eventID = r.eventID;
+        entry->quantity = r.quantity;
+        snprintf(entry->name, sizeof(entry->name), "%s", r.name);
     }
-
-    // Show details for selected event (VIEW ONLY)
-    clear();
-    char eventName[100], eventVenue[100], eventDate[20], eventTime[20];
-    int eventCapacity;
-    sscanf(events[choice - 1], "%99[^|]|%99[^|]|%19[^|]|%19[^|]|%d", eventName, eventVenue, eventDate, eventTime, &eventCapacity);
-    
-    // First pass: Calculate alignment
-    resetUnifiedBlock();
-    printUnifiedBlockLeft("=== Event Details ===");
-    printUnifiedBlockLeft("");
-    
-    char detail_buf[200];
-    snprintf(detail_buf, sizeof(detail_buf), "Name: %s", eventName);
-    printUnifiedBlockLeft(detail_buf);
-    snprintf(detail_buf, sizeof(detail_buf), "Venue: %s", eventVenue);
-    printUnifiedBlockLeft(detail_buf);
-    snprintf(detail_buf, sizeof(detail_buf), "Date (DD-MM-YYYY): %s", eventDate);
-    printUnifiedBlockLeft(detail_buf);
-    snprintf(detail_buf, sizeof(detail_buf), "Time: %s", eventTime);
-    printUnifiedBlockLeft(detail_buf);
-    snprintf(detail_buf, sizeof(detail_buf), "Seat Capacity: %d", eventCapacity);
-    printUnifiedBlockLeft(detail_buf);
-    printUnifiedBlockLeft("");
-    printUnifiedBlockLeft("Press Enter to return to event list...");
-    
-    // Second pass: Actually display
-    unified_blockFirstCall = 0;
-    printUnifiedBlockLeft("=== Event Details ===");
-    printUnifiedBlockLeft("");
-    
-    snprintf(detail_buf, sizeof(detail_buf), "Name: %s", eventName);
-    printUnifiedBlockLeft(detail_buf);
-    snprintf(detail_buf, sizeof(detail_buf), "Venue: %s", eventVenue);
-    printUnifiedBlockLeft(detail_buf);
-    snprintf(detail_buf, sizeof(detail_buf), "Date (DD-MM-YYYY): %s", eventDate);
-    printUnifiedBlockLeft(detail_buf);
-    snprintf(detail_buf, sizeof(detail_buf), "Time: %s", eventTime);
-    printUnifiedBlockLeft(detail_buf);
-    snprintf(detail_buf, sizeof(detail_buf), "Seat Capacity: %d", eventCapacity);
-    printUnifiedBlockLeft(detail_buf);
-    printUnifiedBlockLeft("");
-    
-    // Simple return prompt (NO BOOKING OPTIONS)
-    char continueBuf[10];
-    inputUnifiedBlock("Press Enter to return to event list...", continueBuf, sizeof(continueBuf));
-    
-    // Return to event list to view more events
-    clear();
-    viewEventDetailsOnly(); // Recursive call to show list again
+    closeRecordFile(&rf);
+    return (version < BINARY_FORMAT_VERSION) ? 2 : 1;
 }
 
-void addEvent()
+// Writes one fixed-size booking record to an open bookings.bin stream
+static int writeBookingRecord(FILE *file, int eventID, int quantity, const char *name)
 {
-    char name[100], venue[100], date[20], time[20];
-    int seatCapacity;
+    BinaryBookingRecord r;
+    memset(&r, 0, sizeof(r));
+    r.eventID = eventID;
+    r.quantity = quantity;
+    snprintf(r.name, sizeof(r.name), "%s", name);
+    return fwrite(&r, sizeof(r), 1, file) == 1;
+}
 
-    // Use unified block system for consistency
-    resetUnifiedBlock();
-    printUnifiedBlockLeft("=== Add New Event ===");
-    printUnifiedBlockLeft("");
-    printUnifiedBlockLeft("Event Name: ");
-    printUnifiedBlockLeft("Venue: ");
-    printUnifiedBlockLeft("Date (DD-MM-YYYY): ");
-    printUnifiedBlockLeft("Time (HH:MM): ");
-    printUnifiedBlockLeft("Seat Capacity: ");
-    
-    // Now get the actual input using unified positioning
-    resetUnifiedBlock();
-    unified_blockFirstCall = 0;
-    printUnifiedBlockLeft("=== Add New Event ===");
-    printUnifiedBlockLeft("");
-    
-    // Get event details with unified block positioning
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-    
-    // Get event name
-    COORD pos = csbi.dwCursorPosition;
-    pos.X = unified_blockStartPos;
-    SetConsoleCursorPosition(hConsole, pos);
-    printf("Event Name: ");
-    fflush(stdout);
-    pos.X += strlen("Event Name: ");
-    SetConsoleCursorPosition(hConsole, pos);
-    fgets(name, sizeof(name), stdin);
-    size_t len = strlen(name);
-    if (len > 0 && name[len - 1] == '\n')
-        name[len - 1] = '\0';
-    
-    // Get venue
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-    pos = csbi.dwCursorPosition;
-    pos.X = unified_blockStartPos;
-    SetConsoleCursorPosition(hConsole, pos);
-    printf("Venue: ");
-    fflush(stdout);
-    pos.X += strlen("Venue: ");
-    SetConsoleCursorPosition(hConsole, pos);
-    fgets(venue, sizeof(venue), stdin);
-    len = strlen(venue);
-    if (len > 0 && venue[len - 1] == '\n')
-        venue[len - 1] = '\0';
-    
-    // Get date
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-    pos = csbi.dwCursorPosition;
-    pos.X = unified_blockStartPos;
-    SetConsoleCursorPosition(hConsole, pos);
-    printf("Date (DD-MM-YYYY): ");
-    fflush(stdout);
-    pos.X += strlen("Date (DD-MM-YYYY): ");
-    SetConsoleCursorPosition(hConsole, pos);
-    fgets(date, sizeof(date), stdin);
-    len = strlen(date);
-    if (len > 0 && date[len - 1] == '\n')
-        date[len - 1] = '\0';
-    
-    // Get time
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-    pos = csbi.dwCursorPosition;
-    pos.X = unified_blockStartPos;
-    SetConsoleCursorPosition(hConsole, pos);
-    printf("Time (HH:MM): ");
-    fflush(stdout);
-    pos.X += strlen("Time (HH:MM): ");
-    SetConsoleCursorPosition(hConsole, pos);
-    fgets(time, sizeof(time), stdin);
-    len = strlen(time);
-    if (len > 0 && time[len - 1] == '\n')
-        time[len - 1] = '\0';
-    
-    // Get seat capacity
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-    pos = csbi.dwCursorPosition;
-    pos.X = unified_blockStartPos;
-    SetConsoleCursorPosition(hConsole, pos);
-    printf("Seat Capacity: ");
-    fflush(stdout);
-    pos.X += strlen("Seat Capacity: ");
-    SetConsoleCursorPosition(hConsole, pos);
-    char buf[16];
-    fgets(buf, sizeof(buf), stdin);
-    len = strlen(buf);
-    if (len > 0 && buf[len - 1] == '\n')
-        buf[len - 1] = '\0';
-    
-    if (sscanf(buf, "%d", &seatCapacity) != 1)
+/**
+ * Append one record to bookings.bin, creating the file (and header) if needed.
+ * A torn record left at the end by a crash is cut off first; the reader skips
+ * it, so appending after it would shift every later record.
+ * Returns 1 on success, 0 on failure.
+ */
+int appendBookingBinary(int eventID, int quantity, const char *name)
+{
+    FILE *file = fopen(BOOKINGS_BIN_FILE, "ab");
+    if (file == NULL) return 0;
+    int ok = 1;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    long whole = (size < (long)sizeof(BinaryHeader)) ? 0
+               : size - (long)((size - sizeof(BinaryHeader)) % sizeof(BinaryBookingRecord));
+    if (whole != size)
     {
-        resetUnifiedBlock();
-    printNotice("Invalid input for seat capacity.", 'W');
-    printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+#ifdef _WIN32
+        ok = _chsize(_fileno(file), whole) == 0;
+#else
+        ok = ftruncate(fileno(file), (off_t)whole) == 0;
+#endif
     }
-
-    FILE *file = fopen("events.txt", "a");
-    if (file == NULL)
+    if (ok && whole == 0)
     {
-        resetUnifiedBlock();
-        printNotice("Error opening events file!", 'E');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        BinaryHeader h;
+        memset(&h, 0, sizeof(h));
+        memcpy(h.magic, "EEBK", 4);
+        h.version = BINARY_FORMAT_VERSION;
+        ok = fwrite(&h, sizeof(h), 1, file) == 1;
     }
-    fprintf(file, "%s|%s|%s|%s|%d\n", name, venue, date, time, seatCapacity);
-    fclose(file);
-    
-    resetUnifiedBlock();
-    printNotice("Event added successfully!", 'S');
-    printNotice("Press any key to continue...", 'I');
-    getch();
-    clear(); // Clear screen after adding event
+    ok = ok && writeBookingRecord(file, eventID, quantity, name);
+    if (fclose(file) != 0) ok = 0;
+    return ok;
 }
 
-void adminViewAllEvents()
+/**
+ * Write a whole booking journal (BookingRecord entries, tombstones negative)
+ * to path in the binary format, replacing it atomically.
+ * Returns 1 on success, 0 on failure.
+ */
+int writeBookingsBinary(const char *path, const BookingRecord *entries, int count)
 {
-    FILE *file = fopen("events.txt", "r");
-    if (file == NULL)
+    AtomicFile out;
+    FILE *file = beginAtomicWrite(&out, path, 1);
+    if (file == NULL) return 0;
+    BinaryHeader h;
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, "EEBK", 4);
+    h.version = BINARY_FORMAT_VERSION;
+    int ok = fwrite(&h, sizeof(h), 1, file) == 1;
+    for (int i = 0; i < count && ok; i++)
     {
-        resetUnifiedBlock();
-    printNotice("No events found.", 'I');
-        return;
+        ok = writeBookingRecord(file, entries[i].eventID, entries[i].quantity, entries[i].name);
+    }
+    if (!ok)
+    {
+        abortAtomicWrite(&out);
+        return 0;
     }
+    return commitAtomicWrite(&out);
+}
 
-    char line[300], name[100], venue[100], date[20], time[20];
-    int seatCapacity, newSeatCapacity;
-    int eventCount = 0;
-    char events[50][300]; // Store up to 50 events
+/**
+ * Convert the data files between backends: toBinary 1 writes events.bin and
+ * bookings.bin from the text files (--import-text), 0 does the reverse
+ * (--export-text). Every event and every journal record is carried over.
+ * Returns 0 on success, 1 on failure (used as the process exit code).
+ */
+int convertStorage(int toBinary)
+{
+    Vector events, entries;
+    vectorInit(&events, sizeof(EventRecord));
+    vectorInit(&entries, sizeof(BookingRecord));
+    int nextID = 1;
+    int ok = 1;
 
-    // Build event list
-    while (fgets(line, sizeof(line), file))
+    if (toBinary)
     {
-        if (sscanf(line, "%99[^|]|%99[^|]|%19[^|]|%19[^|]|%d", name, venue, date, time, &seatCapacity) == 5)
+        setStorageBackend(0);
+        loadEventCatalog(); // Also upgrades old-format events.txt
+        for (int i = 0; i < getEventCount(); i++)
         {
-            eventCount++;
-            snprintf(events[eventCount - 1], sizeof(events[eventCount - 1]), "%s|%s|%s|%s|%d", name, venue, date, time, seatCapacity);
+            EventRecord *ev = vectorPush(&events);
+            if (ev == NULL) { ok = 0; break; }
+            *ev = *getEventAt(i);
+            if (ev->id >= nextID) nextID = ev->id + 1;
         }
+        ok = ok && readJournalEntries(0, &entries) >= 0;
+        ok = ok && writeEventsBinary(events.data, events.count, nextID)
+                && writeBookingsBinary(BOOKINGS_BIN_FILE, entries.data, entries.count);
     }
-    fclose(file);
-    if (eventCount == 0)
+    else
     {
-    printNotice("No events found.", 'I');
-    printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        // Only overwrite a text file when its binary counterpart exists
+        int haveEvents = readEventsBinary(&events, &nextID);
+        int haveBookings = readJournalEntries(1, &entries);
+        ok = haveEvents > 0 && haveBookings >= 0;
+        AtomicFile out;
+        FILE *file = ok ? beginAtomicWrite(&out, EVENTS_FILE, 0) : NULL;
+        for (int i = 0; file && i < events.count; i++)
+        {
+            const EventRecord *ev = vectorAt(&events, i);
+            fprintf(file, "%d|%s|%s|%s|%s|%d\n", ev->id, ev->name, ev->venue, ev->date, ev->time, ev->seatCapacity);
+        }
+        if (file == NULL || !commitAtomicWrite(&out)) ok = 0;
+        file = (ok && haveBookings > 0) ? beginAtomicWrite(&out, BOOKINGS_FILE, 0) : NULL;
+        for (int i = 0; file && i < entries.count; i++)
+        {
+            const BookingRecord *b = vectorAt(&entries, i);
+            writeJournalLine(file, b->eventID, b->quantity, b->name);
+        }
+        if (haveBookings > 0 && (file == NULL || !commitAtomicWrite(&out))) ok = 0;
     }
-    // Render boxed list
-    const char *ptrs[60];
-    char items[60][200];
-    for (int i = 0; i < eventCount; i++)
+
+    if (ok) printf("Converted %d event(s) and %d booking record(s) to %s files.\n",
+                   events.count, entries.count, toBinary ? "binary" : "text");
+    else fprintf(stderr, "Conversion failed.\n");
+    vectorFree(&events);
+    vectorFree(&entries);
+    return ok ? 0 : 1;
+}
+
+// Returns 1 if path holds a header with this magic and a version we read, 0 if missing, -1 if not
+static int probeBinaryFile(const char *path, const char *magic)
+{
+    RecordFile rf;
+    if (!openRecordFile(&rf, path)) return 0;
+    int ok = binaryHeader(&rf, magic) != NULL;
+    closeRecordFile(&rf);
+    return ok ? 1 : -1;
+}
+
+/**
+ * Check before startup that events.bin and bookings.bin are either missing
+ * or readable. Prints the reason to stderr when one is not.
+ * Returns 1 if the program may start, 0 if it must not.
+ */
+int checkBinaryStorage()
+{
+    Vector events;
+    vectorInit(&events, sizeof(EventRecord));
+    int nextID = 1;
+    int ok = 1;
+    if (readEventsBinary(&events, &nextID) < 0)
+    {
+        fprintf(stderr, "%s is damaged or from a newer version; not starting.\n", EVENTS_BIN_FILE);
+        ok = 0;
+    }
+    if (probeBinaryFile(BOOKINGS_BIN_FILE, "EEBK") < 0)
     {
-        char nm[100], vn[100], dt[20], tm[20]; int cap;
-        sscanf(events[i], "%99[^|]|%99[^|]|%19[^|]|%19[^|]|%d", nm, vn, dt, tm, &cap);
-        snprintf(items[i], sizeof(items[0]), "%d. %s", i + 1, nm);
-        ptrs[i] = items[i];
+        fprintf(stderr, "%s is damaged or from a newer version; not starting.\n", BOOKINGS_BIN_FILE);
+        ok = 0;
     }
-    char retLine[64];
-    snprintf(retLine, sizeof(retLine), "%d. Return to admin menu", eventCount + 1);
-    ptrs[eventCount] = retLine;
-    printMenuItemsWithBoxes("All Events", ptrs, eventCount + 1);
+    vectorFree(&events);
+    return ok;
+}
 
-    if (eventCount == 0)
-        return;
+/*
+ * ========================= BOOKING SYSTEM =========================
+ */
 
-    int choice;
-    char selectPrompt[100];
-    snprintf(selectPrompt, sizeof(selectPrompt), "Select an event to view/edit/delete or %d to return: ", eventCount + 1);
-    char buf[16];
-    inputUnified(selectPrompt, buf, sizeof(buf));
-    if (sscanf(buf, "%d", &choice) != 1)
+/**
+ * Helper function: Returns event name for given event ID
+ */
+const char* getEventNameByID(int eventID)
+{
+    const EventRecord *ev = getEventByID(eventID);
+    return ev ? ev->name : "Unknown Event";
+}
+
+// " (x3)" after a booking that holds several seats, "" otherwise
+static const char* seatCountSuffix(Arena *arena, int quantity)
+{
+    return (quantity > 1) ? arenaStrf(arena, " (x%d)", quantity) : "";
+}
+
+/**
+ * Collect live bookings in a single pass and join each row with its event name.
+ * Names are resolved through the ID-indexed event catalog as rows are copied,
+ * so a listing never touches the data files.
+ * If userName is not NULL only that user's bookings are returned, found
+ * through the user -> bookings index without looking at anyone else's.
+ * rows must be a Vector of BookingRow; returns the number of rows it holds.
+ */
+int loadBookingRows(Vector *rows, const char *userName)
+{
+    int i = (userName != NULL) ? firstBookingOfUser(userName) : 0;
+    for (; i >= 0 && i < bookingRecordCount; i = (userName != NULL) ? nextBookingOfUser(i) : i + 1)
     {
-        resetUnifiedBlock();
-    printNotice("Invalid input.", 'W');
-    printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        const BookingRecord *b = getBookingRecord(i);
+        if (!b->active) continue;
+        BookingRow *row = vectorPush(rows);
+        if (row == NULL) break;
+        row->eventID = b->eventID;
+        row->quantity = b->quantity;
+        snprintf(row->name, sizeof(row->name), "%s", b->name);
+        row->eventName = getEventNameByID(b->eventID);
     }
-    if (choice < 1 || choice > eventCount + 1)
+    return rows->count;
+}
+
+void viewAllBookings()
+{
+    Arena *arena = beginScreenArena("My Bookings");
+    syncBookingJournal();
+    // Check if user is logged in
+    if (strlen(loggedInUserName) == 0)
     {
-        resetUnifiedBlock();
-    printNotice("Invalid choice.", 'W');
+    printNotice("You must be logged in to view your bookings.", 'E');
     printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
-    }
-    if (choice == eventCount + 1)
-    {
-        clear(); // Clear screen before returning to admin dashboard
+        termGetKey();
         return;
     }
 
-    // Show details for selected event
-    clear();
-    sscanf(events[choice - 1], "%99[^|]|%99[^|]|%19[^|]|%19[^|]|%d", name, venue, date, time, &seatCapacity);
+    Vector bookingRows; // Current user's bookings, already joined with event names
+    vectorInit(&bookingRows, sizeof(BookingRow));
+    int userBookingCount = loadBookingRows(&bookingRows, loggedInUserName);
+    BookingRow *userBookings = bookingRows.data;
     
-    resetUnifiedBlock();
-    printUnifiedBlockLeft("=== Event Details ===");
-    printUnifiedBlockLeft("");
-    
-    char buf_output[200];
-    snprintf(buf_output, sizeof(buf_output), "Name: %s", name);
-    printUnifiedBlockLeft(buf_output);
-    snprintf(buf_output, sizeof(buf_output), "Venue: %s", venue);
-    printUnifiedBlockLeft(buf_output);
-    snprintf(buf_output, sizeof(buf_output), "Date (DD-MM-YYYY): %s", date);
-    printUnifiedBlockLeft(buf_output);
-    snprintf(buf_output, sizeof(buf_output), "Time: %s", time);
-    printUnifiedBlockLeft(buf_output);
-    snprintf(buf_output, sizeof(buf_output), "Seat Capacity: %d", seatCapacity);
-    printUnifiedBlockLeft(buf_output);
-    printUnifiedBlockLeft("");
-    
-    // Second pass - actually print
-    unified_blockFirstCall = 0;
-    printUnifiedBlockLeft("=== Event Details ===");
-    printUnifiedBlockLeft("");
-    snprintf(buf_output, sizeof(buf_output), "Name: %s", name);
-    printUnifiedBlockLeft(buf_output);
-    snprintf(buf_output, sizeof(buf_output), "Venue: %s", venue);
-    printUnifiedBlockLeft(buf_output);
-    snprintf(buf_output, sizeof(buf_output), "Date (DD-MM-YYYY): %s", date);
-    printUnifiedBlockLeft(buf_output);
-    snprintf(buf_output, sizeof(buf_output), "Time: %s", time);
-    printUnifiedBlockLeft(buf_output);
-    snprintf(buf_output, sizeof(buf_output), "Seat Capacity: %d", seatCapacity);
-    printUnifiedBlockLeft(buf_output);
-    printUnifiedBlockLeft("");
+    if (userBookingCount == 0)
     {
-        const char *evtMenu2[] = {
-            "1. Edit Event",
-            "2. Delete Event",
-            "3. Return"
-        };
-        printMenuItemsWithBoxes("Actions", evtMenu2, 3);
+    vectorFree(&bookingRows);
+    const char *buf = arenaStrf(arena, "No bookings found for %s.", loggedInUserName);
+    boxBordered(buf, visualLen(buf) + 2);
+    printUnified("");
+    printNotice("Press any key to continue...", 'I');
+    termGetKey();
+        return;
     }
     
-    int action;
-    char buf2[16];
-    inputUnified("Select an option: ", buf2, sizeof(buf2));
-    if (sscanf(buf2, "%d", &action) != 1)
+    // Build boxed list for user bookings
+    const char *title = arenaStrf(arena, "Your Bookings (%s)", loggedInUserName);
+    StringList items;
+    stringListInit(&items, arena);
+    for (int i = 0; i < userBookingCount; i++)
     {
-        resetUnifiedBlock();
-    printNotice("Invalid input.", 'W');
-        return;
+        stringListAddf(&items, "%d | %s%s", userBookings[i].eventID, userBookings[i].eventName,
+                       seatCountSuffix(arena, userBookings[i].quantity));
     }
+    printMenuItemsWithBoxes(title, items.items, items.count);
+    vectorFree(&bookingRows);
 
-    if (action == 1)
-    {
-        // Edit event
-        clear();
-        char newName[100], newVenue[100], newDate[20], newTime[20];
-        char promptName[150];
-        snprintf(promptName, sizeof(promptName), "Enter new event name (or press Enter to keep '%s'): ", name);
-        inputUnifiedBlock(promptName, newName, sizeof(newName));
-        if (strlen(newName) == 0)
-            strcpy(newName, name);
-
-        char promptVenue[150];
-        snprintf(promptVenue, sizeof(promptVenue), "Enter new venue (or press Enter to keep '%s'): ", venue);
-        inputUnifiedBlock(promptVenue, newVenue, sizeof(newVenue));
-        if (strlen(newVenue) == 0)
-            strcpy(newVenue, venue);
-
-        char promptDate[150];
-        snprintf(promptDate, sizeof(promptDate), "Enter new date (DD-MM-YYYY) (or press Enter to keep '%s'): ", date);
-        inputUnifiedBlock(promptDate, newDate, sizeof(newDate));
-        if (strlen(newDate) == 0)
-            strcpy(newDate, date);
-
-        char promptTime[150];
-        snprintf(promptTime, sizeof(promptTime), "Enter new time (or press Enter to keep '%s'): ", time);
-        inputUnifiedBlock(promptTime, newTime, sizeof(newTime));
-        if (strlen(newTime) == 0)
-            strcpy(newTime, time);
-
-        char promptSeat[100];
-        snprintf(promptSeat, sizeof(promptSeat), "Enter new seat capacity (or 0 to keep %d): ", seatCapacity);
-        char buf3[16];
-        inputUnifiedBlock(promptSeat, buf3, sizeof(buf3));
-        if (sscanf(buf3, "%d", &newSeatCapacity) != 1 || newSeatCapacity <= 0)
-            newSeatCapacity = seatCapacity;
+    // Centered continue prompt
+    char continueBuf[10];
+    inputUnified("Press Enter to continue...", continueBuf, sizeof(continueBuf));
+    clear();
+}
 
-        // Update event in array (without extra newline)
-        snprintf(events[choice - 1], sizeof(events[choice - 1]), "%s|%s|%s|%s|%d", newName, newVenue, newDate, newTime, newSeatCapacity);
-        
-        resetUnifiedBlock();
-    printNotice("Event updated successfully!", 'S');
-    printNotice("Press any key to continue...", 'I');
-        getch();
-        clear(); // Clear screen after event update
-    }
-    else if (action == 2)
+void adminViewAllBookings()
+{
+    Arena *arena = beginScreenArena("Admin Bookings");
+    syncBookingJournal();
+    Vector bookingRows; // All bookings, already joined with event names
+    vectorInit(&bookingRows, sizeof(BookingRow));
+    int totalBookingCount = loadBookingRows(&bookingRows, NULL);
+    BookingRow *allBookings = bookingRows.data;
+    if (totalBookingCount == 0)
     {
-        // Delete event
-        for (int i = choice - 1; i < eventCount - 1; i++)
-        {
-            strcpy(events[i], events[i + 1]);
-        }
-        eventCount--;
-        clear();
-        resetUnifiedBlock();
-    printNotice("Event deleted successfully!", 'S');
+        vectorFree(&bookingRows);
+        boxBordered("No bookings found.", visualLen("No bookings found.") + 2);
+        printUnified("");
     printNotice("Press any key to continue...", 'I');
-        getch();
-    }
-    else
-    {
-        clear();
+        termGetKey();
         return;
     }
 
-    // Write updated events back to file
-    file = fopen("events.txt", "w");
-    if (file == NULL)
-    {
-        resetUnifiedBlock();
-        printNotice("Error updating events file!", 'E');
-        return;
-    }
-    for (int i = 0; i < eventCount; i++)
+    // Build boxed list
+    StringList items;
+    stringListInit(&items, arena);
+    for (int i = 0; i < totalBookingCount; i++)
     {
-        fprintf(file, "%s\n", events[i]);
+        stringListAddf(&items, "%s - %s%s", allBookings[i].name, allBookings[i].eventName,
+                       seatCountSuffix(arena, allBookings[i].quantity));
     }
-    fclose(file);
+    printMenuItemsWithBoxes("All Bookings (Admin View)", items.items, items.count);
+    vectorFree(&bookingRows);
+
+    // Centered continue prompt
+    char continueBuf[10];
+    inputUnified("Press Enter to continue...", continueBuf, sizeof(continueBuf));
+    clear();
 }
 
 /**
- * Admin function to view all registered users
+ * Admin occupancy report: booked seats, capacity and fill % per event.
+ * Reads the seat counters kept by the journal, so it costs O(events)
+ * however many bookings there are.
  */
-void viewAllUsers()
+void adminOccupancyReport()
 {
-    FILE *file = fopen(USER_INFO_FILE, "r");
-    if (file == NULL)
+    Arena *arena = beginScreenArena("Occupancy Report");
+    refreshEventCatalog();
+    syncBookingJournal();
+    int eventCount = getEventCount();
+    if (eventCount == 0)
     {
-        boxBordered("No users found.", visualLen("No users found.") + 2);
+        boxBordered("No events found.", visualLen("No events found.") + 2);
         printUnified("");
     printNotice("Press any key to continue...", 'I');
-        getch();
+        termGetKey();
         return;
     }
 
-    char line[200];
-    int ticketCode;
-    char name[100];
-    // Build boxed list of users
-    const char *ptrs[120];
-    char items[120][300];
-    int count = 0;
-    while (fgets(line, sizeof(line), file) && count < 120)
-    {
-        if (sscanf(line, "%d,%99[^\n]", &ticketCode, name) == 2)
-        {
-            snprintf(items[count], sizeof(items[0]), "%04d | %s", ticketCode, name);
-            ptrs[count] = items[count];
-            count++;
-        }
-    }
-    fclose(file);
-    if (count == 0)
+    StringList items;
+    stringListInit(&items, arena);
+    long totalBooked = 0, totalCapacity = 0;
+    for (int i = 0; i < eventCount; i++)
     {
-        boxBordered("No users found.", visualLen("No users found.") + 2);
-        printUnified("");
-    printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        const EventRecord *ev = getEventAt(i);
+        int booked = getBookedSeats(ev->id);
+        int fill = (ev->seatCapacity > 0) ? (int)(booked * 1000L / ev->seatCapacity) : 0; // Tenths of a percent
+        stringListAddf(&items, "%d | %s | %d/%d seats (%d.%d%%)", ev->id, ev->name, booked, ev->seatCapacity,
+                       fill / 10, fill % 10);
+        totalBooked += booked;
+        totalCapacity += ev->seatCapacity;
     }
-    printMenuItemsWithBoxes("All Registered Users", ptrs, count);
+    int totalFill = (totalCapacity > 0) ? (int)(totalBooked * 1000 / totalCapacity) : 0;
+    stringListAddf(&items, "Total | %ld/%ld seats (%d.%d%%)", totalBooked, totalCapacity,
+                   totalFill / 10, totalFill % 10);
+    printMenuItemsWithBoxes("Occupancy Report", items.items, items.count);
 
     // Centered continue prompt
     char continueBuf[10];
@@ -1198,669 +4277,987 @@ void viewAllUsers()
     clear();
 }
 
-/**
- * Admin: Remove a user by entering a 4-digit ticket ID or their name.
- * Also removes all bookings for that user.
- */
-void removeUser()
+void bookSeat()
 {
-    // Load users
-    FILE *file = fopen(USER_INFO_FILE, "r");
-    if (file == NULL)
+    Arena *arena = beginScreenArena("Book Seat");
+    refreshEventCatalog();
+    syncBookingJournal();
+    int choice;
+
+
+    if (strlen(loggedInUserName) == 0)
     {
-        boxBordered("No users found.", visualLen("No users found.") + 2);
-        printUnified("");
+        printNotice("You must be logged in to book a seat.", 'E');
         printNotice("Press any key to continue...", 'I');
-        getch();
+        termGetKey();
         return;
     }
 
-    typedef struct { int ticket; char name[100]; } UserEntry;
-    UserEntry users[200];
-    int count = 0;
-    char line[256];
-    while (fgets(line, sizeof(line), file) && count < 200)
+    int eventCount = getEventCount();
+    if (eventCount == 0)
     {
-        if (sscanf(line, "%d,%99[^\n]", &users[count].ticket, users[count].name) == 2)
-        {
-            count++;
-        }
+        printNotice("No events found.", 'I');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
     }
-    fclose(file);
 
-    if (count == 0)
+    StringList items;
+    stringListInit(&items, arena);
+    for (int i = 0; i < eventCount; i++)
     {
-        boxBordered("No users found.", visualLen("No users found.") + 2);
-        printUnified("");
+        stringListAddf(&items, "%d. %s", i + 1, getEventAt(i)->name);
+    }
+    stringListAddf(&items, "%d. Return to main menu", eventCount + 1);
+    printMenuItemsWithBoxes("Book a Seat", items.items, items.count);
+
+    char buf2[16];
+    inputUnified("Enter event ID to book: ", buf2, sizeof(buf2));
+    if (sscanf(buf2, "%d", &choice) != 1)
+    {
+        printNotice("Invalid input for Event ID.", 'W');
         printNotice("Press any key to continue...", 'I');
-        getch();
+        termGetKey();
         return;
     }
 
-    // Build boxed list like others
-    const char *ptrs[200];
-    char items[200][300];
-    for (int i = 0; i < count; i++)
+    if (choice < 1 || choice > eventCount + 1)
     {
-        snprintf(items[i], sizeof(items[0]), "%04d | %s", users[i].ticket, users[i].name);
-        ptrs[i] = items[i];
+        printNotice("Invalid Event ID.", 'W');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
     }
-    printMenuItemsWithBoxes("All Registered Users", ptrs, count);
 
-    // Prompt for input with ability to cancel
-    char input[128];
-    inputUnified("Enter ticket ID (4 digits) or user name to remove (or press Enter to cancel): ", input, sizeof(input));
-    if (strlen(input) == 0)
+    if (choice == eventCount + 1)
     {
-        printNotice("Removal canceled.", 'I');
-        printNotice("Press any key to continue...", 'I');
-        getch();
         clear();
         return;
     }
 
-    // Resolve selection
-    int isTicket = 0, targetTicket = -1, targetIndex = -1;
-    int tmp;
-    if (sscanf(input, "%d", &tmp) == 1) { isTicket = 1; targetTicket = tmp; }
+    int eventID = getEventAt(choice - 1)->id;
+    int remaining = getSeatsRemaining(eventID);
+    if (remaining <= 0)
+    {
+        printNotice(arenaStrf(arena, "Sorry, %s is fully booked.", getEventNameByID(eventID)), 'W');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
+        return;
+    }
 
-    for (int i = 0; i < count; i++)
+    // A second booking of the same event adds seats to the existing one; ask how many
+    int seats = 1;
+    int held = getBookedQuantity(eventID, loggedInUserName);
+    if (held > 0)
     {
-        if (isTicket)
+        char answer[16];
+        printNotice(arenaStrf(arena, "You already have %d seat(s) for %s.", held, getEventNameByID(eventID)), 'I');
+        inputUnified(arenaStrf(arena, "Seats to add (1-%d, 0 to cancel): ", remaining), answer, sizeof(answer));
+        if (sscanf(answer, "%d", &seats) != 1 || seats <= 0)
         {
-            if (users[i].ticket == targetTicket) { targetIndex = i; break; }
+            clear();
+            return;
         }
-        else
+        if (seats > remaining)
         {
-            if (equalsIgnoreCase(users[i].name, input)) { targetIndex = i; break; }
+            printNotice(arenaStrf(arena, "Only %d seat(s) left for %s.", remaining, getEventNameByID(eventID)), 'W');
+            printNotice("Press any key to continue...", 'I');
+            termGetKey();
+            return;
         }
     }
 
-    if (targetIndex == -1)
+    int booked = saveBooking(eventID, loggedInUserName, seats);
+    if (booked == 0)
     {
-        printNotice("No matching user found.", 'I');
+        printNotice(arenaStrf(arena, "Sorry, %s is fully booked.", getEventNameByID(eventID)), 'W');
         printNotice("Press any key to continue...", 'I');
-        getch();
-        clear();
+        termGetKey();
         return;
     }
-
-    // Confirmation block using unified block style
-    resetUnifiedBlock();
-    printUnifiedBlockLeft("Confirm User Deletion");
-    printUnifiedBlockLeft("");
-    char buf[256];
-    snprintf(buf, sizeof(buf), "Ticket: %04d", users[targetIndex].ticket);
-    printUnifiedBlockLeft(buf);
-    snprintf(buf, sizeof(buf), "Name: %s", users[targetIndex].name);
-    printUnifiedBlockLeft(buf);
-    printUnifiedBlockLeft("");
-    printUnifiedBlockLeft("Type YES to confirm deletion (anything else to cancel)");
-    // Second pass display
-    unified_blockFirstCall = 0;
-    printUnifiedBlockLeft("Confirm User Deletion");
-    printUnifiedBlockLeft("");
-    snprintf(buf, sizeof(buf), "Ticket: %04d", users[targetIndex].ticket);
-    printUnifiedBlockLeft(buf);
-    snprintf(buf, sizeof(buf), "Name: %s", users[targetIndex].name);
-    printUnifiedBlockLeft(buf);
-    printUnifiedBlockLeft("");
-    char confirm[16];
-    inputUnifiedBlock("Type YES to confirm: ", confirm, sizeof(confirm));
-
-    if (!(equalsIgnoreCase(confirm, "YES")))
+    if (booked < 0)
     {
-        printNotice("Deletion canceled.", 'I');
         printNotice("Press any key to continue...", 'I');
-        getch();
-        clear();
-        return;
-    }
-
-    // Rewrite users excluding the target
-    FILE *out = fopen("temp.txt", "w");
-    if (out == NULL)
-    {
-        printNotice("Error opening temp file.", 'E');
+        termGetKey();
         return;
     }
-    for (int i = 0; i < count; i++)
-    {
-        if (i == targetIndex) continue;
-        fprintf(out, "%04d,%s\n", users[i].ticket, users[i].name);
-    }
-    fclose(out);
-    remove(USER_INFO_FILE);
-    rename("temp.txt", USER_INFO_FILE);
 
-    // Cascade delete bookings
-    int removedBookings = removeBookingsByUserName(users[targetIndex].name);
+    clear();
+    printNotice("Booking Confirmation", 'S');
+    printNotice(arenaStrf(arena, "Seat booked successfully for %s", loggedInUserName), 'S');
+    printNotice(arenaStrf(arena, "Event ID: %d", eventID), 'I');
+    printNotice(arenaStrf(arena, "Event: %s", getEventNameByID(eventID)), 'I');
+    if (held > 0) printNotice(arenaStrf(arena, "Your seats for this event: %d", held + seats), 'I');
+    printNotice(arenaStrf(arena, "Seats remaining: %d", getSeatsRemaining(eventID)), 'I');
 
-    printNotice("User removed successfully.", 'S');
-    if (removedBookings > 0)
-    {
-        char ibuf[128];
-        snprintf(ibuf, sizeof(ibuf), "Also removed %d booking(s) for this user.", removedBookings);
-        printNotice(ibuf, 'I');
-    }
-    printNotice("Press any key to continue...", 'I');
-    getch();
+    char continueBuf[10];
+    inputUnified("Press Enter to continue...", continueBuf, sizeof(continueBuf));
     clear();
 }
 
-/*
- * ========================= BOOKING SYSTEM =========================
- */
 
-/**
- * Helper function: Returns event name for given event ID
- */
-char* getEventNameByID(int eventID)
+void cancelBooking()
 {
-    FILE *file = fopen("events.txt", "r");
-    if (file == NULL)
-    {
-        static char defaultName[] = "Unknown Event";
-        return defaultName;
-    }
-
-    char line[300], name[100], venue[100], date[20], time[20];
-    int seatCapacity;
-    int currentEventID = 1;
-    static char eventName[100]; // Static to persist after function returns
-
-    while (fgets(line, sizeof(line), file))
-    {
-        if (sscanf(line, "%99[^|]|%99[^|]|%19[^|]|%19[^|]|%d", name, venue, date, time, &seatCapacity) == 5)
-        {
-            if (currentEventID == eventID)
-            {
-                fclose(file);
-                strcpy(eventName, name); // Copy to static variable
-                return eventName;
-            }
-            currentEventID++;
-        }
-    }
-    
-    fclose(file);
-    strcpy(eventName, "Unknown Event"); // Event ID not found
-    return eventName;
-}
+    Arena *arena = beginScreenArena("Cancel Booking");
+    syncBookingJournal();
+    int eventID;
 
-void viewAllBookings()
-{
     // Check if user is logged in
     if (strlen(loggedInUserName) == 0)
     {
-    printNotice("You must be logged in to view your bookings.", 'E');
+    printNotice("You must be logged in to cancel a booking.", 'E');
     printNotice("Press any key to continue...", 'I');
-        getch();
+        termGetKey();
         return;
     }
 
-    FILE *file = fopen(BOOKINGS_FILE, "r");
-    if (file == NULL)
+    // First, show user's current bookings
+    Vector bookingRows; // Current user's bookings, already joined with event names
+    vectorInit(&bookingRows, sizeof(BookingRow));
+    int userBookingCount = loadBookingRows(&bookingRows, loggedInUserName);
+    BookingRow *userBookings = bookingRows.data;
+    
+    if (userBookingCount == 0)
     {
-        boxBordered("No bookings found.", visualLen("No bookings found.") + 2);
-        printUnified("");
-    printNotice("Press any key to continue...", 'I');
-        getch();
+        vectorFree(&bookingRows);
+        printNotice(arenaStrf(arena, "No bookings found for %s to cancel.", loggedInUserName), 'I');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
         return;
     }
-
-    char line[200];
-    int eventID;
-    char name[100];
-    char userBookings[50][200]; // Array to store current user's bookings
-    int userBookingCount = 0;
-
-    // First pass: collect booking information for the logged-in user only
-    while (fgets(line, sizeof(line), file) && userBookingCount < 50)
+    
+    // Build boxed list of user's bookings
+    StringList items;
+    stringListInit(&items, arena);
+    for (int i = 0; i < userBookingCount; i++)
     {
-        if (sscanf(line, "%d %[^\n]", &eventID, name) == 2)
-        {
-            // Only store bookings for the current logged-in user
-            if (strcmp(name, loggedInUserName) == 0)
-            {
-                strcpy(userBookings[userBookingCount], line);
-                userBookingCount++;
-            }
-        }
+        stringListAddf(&items, "%d | %s%s", userBookings[i].eventID, userBookings[i].eventName,
+                       seatCountSuffix(arena, userBookings[i].quantity));
     }
-    fclose(file);
-    
-    if (userBookingCount == 0)
+    printMenuItemsWithBoxes(arenaStrf(arena, "Your Current Bookings (%s)", loggedInUserName), items.items, items.count);
+    vectorFree(&bookingRows);
+
+    // Now ask for the event ID to cancel
+    char buf[16];
+    inputUnified("Enter Event ID to cancel: ", buf, sizeof(buf));
+    if (sscanf(buf, "%d", &eventID) != 1)
     {
-    char buf[200];
-    snprintf(buf, sizeof(buf), "No bookings found for %s.", loggedInUserName);
-    boxBordered(buf, visualLen(buf) + 2);
-    printUnified("");
-    printNotice("Press any key to continue...", 'I');
-    getch();
+        printNotice("Invalid input for Event ID.", 'W');
+        printNotice("Press any key to continue...", 'I');
+        termGetKey();
         return;
     }
-    
-    // Build boxed list for user bookings
-    char title[256];
-    snprintf(title, sizeof(title), "Your Bookings (%s)", loggedInUserName);
-    const char *ptrs[60];
-    char items[60][300];
-    int itemsCount = 0;
-    for (int i = 0; i < userBookingCount && itemsCount < 60; i++)
-    {
-        if (sscanf(userBookings[i], "%d %[^\n]", &eventID, name) == 2)
-        {
-            char *eventName = getEventNameByID(eventID);
-            snprintf(items[itemsCount++], sizeof(items[0]), "%d | %s", eventID, eventName);
-        }
-    }
-    for (int i = 0; i < itemsCount; i++) ptrs[i] = items[i];
-    printMenuItemsWithBoxes(title, ptrs, itemsCount);
 
-    // Centered continue prompt
+    // Use the logged-in user's name for cancellation
+    removeBooking(eventID, loggedInUserName);
+
+    // Add prompt to continue
     char continueBuf[10];
-    inputUnified("Press Enter to continue...", continueBuf, sizeof(continueBuf));
-    clear();
+    inputUnifiedBlock(NULL, "Press Enter to continue...", continueBuf, sizeof(continueBuf));
+    clear(); // Clear screen after cancellation process
 }
 
-void adminViewAllBookings()
+/**
+ * Book seats for name at eventID if the event still has room for all of them.
+ * They are journalled as one EventID*Seats record, and the capacity check and
+ * the write happen here so no caller can oversell.
+ * Returns 1 if booked, 0 if the event lacks room, -1 if the booking could not be saved.
+ */
+int saveBooking(int eventID, const char *name, int seats)
 {
-    FILE *file = fopen(BOOKINGS_FILE, "r");
-    if (file == NULL)
+    syncBookingJournal(); // Seats another running copy sold since the screen opened
+    if (seats <= 0 || getSeatsRemaining(eventID) < seats)
     {
-        boxBordered("No bookings found.", visualLen("No bookings found.") + 2);
-        printUnified("");
-    printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        return 0;
     }
-
-    char line[200];
-    int eventID;
-    char name[100];
-    char allBookings[100][200]; // Array to store all bookings
-    int totalBookingCount = 0;
-
-    // Collect all booking information
-    while (fgets(line, sizeof(line), file) && totalBookingCount < 100)
+    if (!appendJournalLine(eventID, seats, name))
     {
-        if (sscanf(line, "%d %[^\n]", &eventID, name) == 2)
-        {
-            strcpy(allBookings[totalBookingCount], line);
-            totalBookingCount++;
-        }
+        printNotice("Error opening file, Name of event ID not Found!", 'E');
+        return -1;
     }
-    fclose(file);
-    
-    if (totalBookingCount == 0)
+    addBookingRecord(eventID, name, seats);
+    return 1;
+}
+
+// Cancels one seat by appending a tombstone; cost does not depend on the journal size
+void removeBooking(int eventID, const char *name)
+{
+    int index = findLiveBooking(eventID, name);
+    if (index < 0)
     {
-        boxBordered("No bookings found.", visualLen("No bookings found.") + 2);
-        printUnified("");
-    printNotice("Press any key to continue...", 'I');
-        getch();
+        char buf[200];
+        snprintf(buf, sizeof(buf), "No booking found for %s at event ID %d.", name, eventID);
+        printNotice(buf, 'I');
         return;
     }
 
-    // Build boxed list
-    const char *ptrs[120];
-    char items[120][300];
-    int itemsCount = 0;
-    for (int i = 0; i < totalBookingCount && itemsCount < 120; i++)
+    if (!appendJournalLine(-eventID, 1, name))
     {
-        if (sscanf(allBookings[i], "%d %[^\n]", &eventID, name) == 2)
-        {
-            char *eventName = getEventNameByID(eventID);
-            snprintf(items[itemsCount++], sizeof(items[0]), "%s - %s", name, eventName);
-        }
+        printNotice("Error opening file!", 'E');
+        return;
     }
-    for (int i = 0; i < itemsCount; i++) ptrs[i] = items[i];
-    printMenuItemsWithBoxes("All Bookings (Admin View)", ptrs, itemsCount);
-
-    // Centered continue prompt
-    char continueBuf[10];
-    inputUnified("Press Enter to continue...", continueBuf, sizeof(continueBuf));
-    clear();
+    cancelBookingRecord(index, 1);
+    bookingTombstoneCount++;
+    compactBookingJournalIfNeeded();
+    printNotice("Booking successfully canceled.", 'S');
 }
 
-void bookSeat()
+/**
+ * Remove all bookings associated with a given user name.
+ * Appends one tombstone per booking (covering all its seats) instead of
+ * rewriting the file.
+ * Returns the count of removed seats.
+ */
+int removeBookingsByUserName(const char *name)
 {
-    int eventID;
-
-    resetUnifiedBlock();
+    int removed = 0;
+    for (int i = firstBookingOfUser(name); i >= 0; i = nextBookingOfUser(i))
+    {
+        const BookingRecord *b = getBookingRecord(i);
+        if (!b->active) continue;
+        int seats = b->quantity;
+        if (!appendJournalLine(-b->eventID, seats, name)) break;
+        cancelBookingRecord(i, seats);
+        bookingTombstoneCount++;
+        removed += seats;
+    }
+    compactBookingJournalIfNeeded();
+    return removed;
+}
 
-    if (strlen(loggedInUserName) == 0)
+/**
+ * Remove all bookings for an event that is being deleted.
+ * Walks only that event's chain and appends one tombstone per booking.
+ * Returns the count of removed seats.
+ */
+int removeBookingsByEventID(int eventID)
+{
+    int removed = 0;
+    for (int i = firstBookingOfEvent(eventID); i >= 0; i = nextBookingOfEvent(i))
     {
-        printNotice("You must be logged in to book a seat.", 'E');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        const BookingRecord *b = getBookingRecord(i);
+        if (!b->active) continue;
+        int seats = b->quantity;
+        if (!appendJournalLine(-eventID, seats, b->name)) break;
+        cancelBookingRecord(i, seats);
+        bookingTombstoneCount++;
+        removed += seats;
     }
+    compactBookingJournalIfNeeded();
+    return removed;
+}
 
-    FILE *file = fopen("events.txt", "r");
-    if (file == NULL)
+/*
+ * ========================= MAIN FUNCTION =========================
+ */
+/**
+ * --bench: write a synthetic events file and time loading it with the old
+ * fgets + sscanf loop against the bulk loader (SIMD and scalar scans).
+ */
+int runLoaderBenchmark(int eventCount)
+{
+    const char *path = "bench_events.tmp";
+    FILE *out = fopen(path, "w");
+    if (out == NULL)
     {
-        printNotice("No events found.", 'I');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        fprintf(stderr, "Cannot create %s\n", path);
+        return 1;
+    }
+    for (int i = 1; i <= eventCount; i++)
+    {
+        fprintf(out, "%d|Benchmark Event %d|Convention Hall %d|%02d-%02d-2025|%02d:00|%d\n",
+                i, i, i % 50, i % 28 + 1, i % 12 + 1, i % 24, 50 + i % 400);
     }
+    fclose(out);
 
-    char line[300], eventName[100], venue[100], date[20], time[20];
-    int seatCapacity;
-    int eventCount = 0;
-    char events[50][300];
+    EventRecord ev;
+    long long checksum[3] = { 0, 0, 0 };
+    double seconds[3];
+    const int rounds = 5;
+
+    // 1) The loop loadEventCatalog used before the bulk loader
+    clock_t started = clock();
+    for (int r = 0; r < rounds; r++)
+    {
+        FILE *file = fopen(path, "r");
+        char line[300];
+        while (file && fgets(line, sizeof(line), file))
+        {
+            if (sscanf(line, "%d|%99[^|]|%99[^|]|%19[^|]|%19[^|]|%d", &ev.id, ev.name, ev.venue, ev.date, ev.time, &ev.seatCapacity) == 6)
+                checksum[0] += ev.seatCapacity;
+        }
+        if (file) fclose(file);
+    }
+    seconds[0] = (double)(clock() - started) / CLOCKS_PER_SEC;
 
-    while (fgets(line, sizeof(line), file))
+    // 2) Bulk loader, then 3) the same with every line and field scan done by the scalar loop
+    for (int mode = 1; mode <= 2; mode++)
     {
-        if (sscanf(line, "%99[^|]|%99[^|]|%19[^|]|%19[^|]|%d", eventName, venue, date, time, &seatCapacity) == 5)
+        setScalarByteScan(mode == 2);
+        started = clock();
+        for (int r = 0; r < rounds; r++)
         {
-            if (eventCount < 50)
+            RecordFile rf;
+            StrView line;
+            if (!openRecordFile(&rf, path)) break;
+            while (nextRecordLine(&rf, &line))
             {
-                snprintf(events[eventCount], sizeof(events[eventCount]), "%s|%s|%s|%s|%d", eventName, venue, date, time, seatCapacity);
-                eventCount++;
+                if (parseEventLine(line, &ev)) checksum[mode] += ev.seatCapacity;
             }
+            closeRecordFile(&rf);
         }
+        seconds[mode] = (double)(clock() - started) / CLOCKS_PER_SEC;
     }
-    fclose(file);
-
-    if (eventCount == 0)
+    setScalarByteScan(0);
+    remove(path);
+
+    const char *labels[3] = { "fgets + sscanf", "bulk loader", "bulk loader (scalar)" };
+#if defined(EVENT_EASE_AVX2)
+    labels[1] = "bulk loader (AVX2)";
+#elif defined(EVENT_EASE_SSE2)
+    labels[1] = "bulk loader (SSE2)";
+#endif
+    printf("Loading %d events x %d rounds%s\n", eventCount, rounds, recordFileMapping ? " (bulk loader mapping files)" : "");
+    for (int i = 0; i < 3; i++)
     {
-        printNotice("No events found.", 'I');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        printf("  %-28s %8.3f s  %8.1f ns/record  (checksum %lld)\n", labels[i], seconds[i],
+               seconds[i] * 1e9 / ((double)eventCount * rounds), checksum[i]);
     }
+    return (checksum[0] == checksum[1] && checksum[1] == checksum[2]) ? 0 : 1;
+}
 
-    const char *ptrs[60];
-    char items[60][200];
-    for (int i = 0; i < eventCount; i++)
+int main(int argc, char *argv[])
+{
+    int showArenaStats = 0;
+    for (int i = 1; i < argc; i++)
     {
-        char nm[100], vn[100], dt[20], tm[20]; int cap;
-        sscanf(events[i], "%99[^|]|%99[^|]|%19[^|]|%19[^|]|%d", nm, vn, dt, tm, &cap);
-        snprintf(items[i], sizeof(items[0]), "%d. %s", i + 1, nm);
-        ptrs[i] = items[i];
+        if (strcmp(argv[i], "--arena-stats") == 0) showArenaStats = 1;
+        if (strcmp(argv[i], "--mmap") == 0) setRecordFileMapping(1);
+        if (strcmp(argv[i], "--storage") == 0 && i + 1 < argc) setStorageBackend(strcmp(argv[++i], "binary") == 0);
+        if (strcmp(argv[i], "--import-text") == 0) return convertStorage(1);
+        if (strcmp(argv[i], "--export-text") == 0) return convertStorage(0);
+        if (strcmp(argv[i], "--bench") == 0)
+        {
+            int count = (i + 1 < argc) ? atoi(argv[i + 1]) : 0;
+            return runLoaderBenchmark(count > 0 ? count : 200000);
+        }
     }
-    char retLine[64];
-    snprintf(retLine, sizeof(retLine), "%d. Return to main menu", eventCount + 1);
-    ptrs[eventCount] = retLine;
-    printMenuItemsWithBoxes("Book a Seat", ptrs, eventCount + 1);
 
-    char promptBuf[100];
-    snprintf(promptBuf, sizeof(promptBuf), "Enter event ID to book: ");
-    char buf2[16];
-    inputUnified(promptBuf, buf2, sizeof(buf2));
-    if (sscanf(buf2, "%d", &eventID) != 1)
+    if (isBinaryStorage() && !checkBinaryStorage()) return 1;
+
+    termInit();                       // UTF-8 output, terminal size, original colors
+    srand((unsigned int)time(NULL));  // Initialize random seed for ticket generation
+    loadEventCatalog();               // Parse events.txt once; screens read from memory
+    loadUserIndex();                  // Hash user_info.txt for constant-time login checks
+    loadBookingJournal();             // Replay bookings.txt into live bookings
+    if (showArenaStats) atexit(printScreenArenaStats);
+    landingPage();
+    return 0;
+}
+
+/*
+ * ========================= TERMINAL BACKEND =========================
+ * The few terminal operations the UI needs, implemented over the Win32
+ * console API on Windows and over termios and ANSI escape sequences
+ * elsewhere. Nothing here spawns a process.
+ *
+ * The terminal size is measured once and cached; every layout routine reads
+ * the cache. On POSIX a SIGWINCH handler marks it stale and the next read
+ * re-measures. Windows line input discards console resize events before the
+ * program can see them, so there clear() re-measures once per screen.
+ *
+ * Output is collected in a frame buffer (stdout, fully buffered) and only
+ * written out when the program waits for input or pauses, so a whole
+ * screen, including the clear that precedes it, reaches the terminal in a
+ * single write. Cursor moves, colors and clearing are escape sequences in
+ * that same buffer; Windows consoles are switched to escape-sequence mode
+ * when they support it and fall back to the console API otherwise.
+ *
+ * On an interactive terminal the UI text also goes through a retained
+ * screen model, like curses' refresh: termWrite composes rows of the next
+ * frame, and termFlush compares them with the rows the terminal already
+ * shows and rewrites only the rows that changed. clear() just starts a new
+ * frame, so redrawing a dashboard that is already on screen sends little
+ * more than the cursor moves. A frame taller than the terminal is written
+ * out in full and allowed to scroll. Pipes and files get the plain stream.
+ */
+
+#define TERM_FRAME_SIZE (256 * 1024)
+
+static int termCachedWidth = 0;
+static int termCachedHeight = 0;
+static volatile sig_atomic_t termResized = 1;  // Cached size is stale (set by SIGWINCH)
+static int termInteractive = 0;  // stdout is a terminal (not a pipe or file)
+static int termRetained = 0;     // UI output goes through the screen model
+static int termEchoesInput = 0;  // stdin is a terminal, so typed lines are already on screen
+static int termColor = TERM_DEFAULT;
+static char termFrame[TERM_FRAME_SIZE];
+static const char *termSgr[] = { "0", "1;32", "1;36", "1;31", "1;33" };
+#ifdef _WIN32
+#ifndef ENABLE_VIRTUAL_TERMINAL_PROCESSING
+#define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004
+#endif
+static int termAnsi = 1;         // Console understands ANSI escape sequences
+static HANDLE termOutput;
+static WORD termOriginalAttrs;
+#endif
+
+static ScreenLine *frameLines = NULL;  // Frame being composed; the last row holds the cursor
+static int frameLineCount = 0;
+static int frameLineCapacity = 0;
+static ScreenLine *shownLines = NULL;  // Rows the terminal shows from the top
+static int shownLineCount = 0;
+static int shownLineCapacity = 0;
+static int shownValid = 0;             // shownLines matches the screen (nothing scrolled since)
+static int presentedRow = -1;          // Frame row holding the cursor at the last flush, -1 if none
+static int shownColor = TERM_DEFAULT;   // Color the terminal is currently in
+
+// Makes room for `count` rows in a row array, leaving new rows empty
+static int reserveScreenLines(ScreenLine **lines, int *capacity, int count)
+{
+    if (count <= *capacity) return 1;
+    int newCapacity = *capacity ? *capacity * 2 : 64;
+    while (newCapacity < count) newCapacity *= 2;
+    ScreenLine *grown = realloc(*lines, (size_t)newCapacity * sizeof(ScreenLine));
+    if (grown == NULL) return 0;
+    memset(grown + *capacity, 0, (size_t)(newCapacity - *capacity) * sizeof(ScreenLine));
+    *lines = grown;
+    *capacity = newCapacity;
+    return 1;
+}
+
+static void appendScreenLine(ScreenLine *line, const char *text, int len)
+{
+    if (len <= 0) return;  // Empty rows may have no buffer yet
+    if (line->len + len + 1 > line->capacity)
     {
-        printNotice("Invalid input for Event ID.", 'W');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        int newCapacity = line->capacity ? line->capacity * 2 : 128;
+        while (newCapacity < line->len + len + 1) newCapacity *= 2;
+        char *grown = realloc(line->text, (size_t)newCapacity);
+        if (grown == NULL) return;
+        line->text = grown;
+        line->capacity = newCapacity;
     }
+    memcpy(line->text + line->len, text, (size_t)len);
+    line->len += len;
+}
+
+// Starts a new row at the bottom of the frame
+static void startFrameLine()
+{
+    if (!reserveScreenLines(&frameLines, &frameLineCapacity, frameLineCount + 1)) return;
+    ScreenLine *line = &frameLines[frameLineCount++];
+    line->len = 0;
+    line->color = termColor;
+}
 
-    if (eventID < 1 || eventID > eventCount + 1)
+// Column the cursor ends at after a row (colors take none, UTF-8 counts per character)
+static int screenLineColumns(const ScreenLine *line)
+{
+    int columns = 0;
+    for (int i = 0; i < line->len; i++)
     {
-        printNotice("Invalid Event ID.", 'W');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        unsigned char c = (unsigned char)line->text[i];
+        if (c == 0x1b)
+        {
+            int start = i + 2;  // Past "ESC ["
+            while (i + 1 < line->len && !isalpha((unsigned char)line->text[i + 1])) i++;
+            i++;
+            if (i < line->len && line->text[i] == 'G') columns = atoi(line->text + start) - 1;  // Column move
+        }
+        else if ((c & 0xC0) != 0x80)
+        {
+            columns++;
+        }
     }
+    return columns;
+}
 
-    if (eventID == eventCount + 1)
+// Records the frame as what the terminal now shows
+static void snapshotFrame()
+{
+    if (!reserveScreenLines(&shownLines, &shownLineCapacity, frameLineCount)) return;
+    for (int i = 0; i < frameLineCount; i++)
     {
-        clear();
-        return;
+        shownLines[i].len = 0;
+        shownLines[i].color = frameLines[i].color;
+        appendScreenLine(&shownLines[i], frameLines[i].text, frameLines[i].len);
     }
-
-    saveBooking(eventID, loggedInUserName);
-
-    clear();
-    sscanf(events[eventID - 1], "%99[^|]|%99[^|]|%19[^|]|%19[^|]|%d", eventName, venue, date, time, &seatCapacity);
-    char msg[256];
-    printNotice("Booking Confirmation", 'S');
-    snprintf(msg, sizeof(msg), "Seat booked successfully for %s", loggedInUserName);
-    printNotice(msg, 'S');
-    snprintf(msg, sizeof(msg), "Event ID: %d", eventID);
-    printNotice(msg, 'I');
-    snprintf(msg, sizeof(msg), "Event: %s", eventName);
-    printNotice(msg, 'I');
-
-    char continueBuf[10];
-    inputUnified("Press Enter to continue...", continueBuf, sizeof(continueBuf));
-    clear();
+    shownLineCount = frameLineCount;
+    presentedRow = frameLineCount - 1;
 }
 
+// Writes one row at the cursor, switching colors only if the terminal is in another one
+static void emitScreenLine(int row)
+{
+    const ScreenLine *line = &frameLines[row];
+    if (line->color != shownColor) printf("\x1b[%sm", termSgr[line->color]);
+    if (line->len > 0) fwrite(line->text, 1, (size_t)line->len, stdout);
+    // A row ends in the color the next row starts with (the last row ends in termColor)
+    shownColor = (row + 1 < frameLineCount) ? frameLines[row + 1].color : termColor;
+}
 
-void cancelBooking()
+// The row still starts with what is shown there, in the same color
+static int shownLinePrefixes(int row)
 {
-    int eventID;
+    const ScreenLine *now = &frameLines[row];
+    const ScreenLine *old = &shownLines[row];
+    return now->color == old->color && now->len >= old->len
+        && (old->len == 0 || memcmp(now->text, old->text, (size_t)old->len) == 0);
+}
 
-    // Check if user is logged in
-    if (strlen(loggedInUserName) == 0)
+// Writes the text a row gained since it was shown, if that is all that changed
+static int extendShownLine(int row)
+{
+    const ScreenLine *now = &frameLines[row];
+    const ScreenLine *old = &shownLines[row];
+    if (!shownLinePrefixes(row)) return 0;
+    if (now->len > old->len)
     {
-    printNotice("You must be logged in to cancel a booking.", 'E');
-    printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        fwrite(now->text + old->len, 1, (size_t)(now->len - old->len), stdout);
+        shownColor = (row + 1 < frameLineCount) ? frameLines[row + 1].color : termColor;
     }
+    return 1;
+}
 
-    // First, show user's current bookings
-    FILE *file = fopen(BOOKINGS_FILE, "r");
-    if (file == NULL)
+// The rows composed so far are on screen already (the last one at least up to its end)
+static int frameAlreadyShown()
+{
+    if (!shownValid || frameLineCount > shownLineCount) return 0;
+    for (int i = 0; i < frameLineCount; i++)
     {
-    printNotice("No bookings found to cancel.", 'I');
-    printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        const ScreenLine *now = &frameLines[i];
+        const ScreenLine *old = &shownLines[i];
+        int lengthMatches = (i == frameLineCount - 1) ? now->len <= old->len : now->len == old->len;
+        if (now->color != old->color || !lengthMatches) return 0;
+        if (now->len > 0 && memcmp(now->text, old->text, (size_t)now->len) != 0) return 0;
     }
+    return 1;
+}
 
-    char line[200];
-    int eventInLine;
-    char nameInLine[100];
-    char userBookings[50][200]; // Array to store current user's bookings
-    int userBookingCount = 0;
+// The frame shows row for row: it fits the height and no row wraps
+static int frameFitsScreen()
+{
+    if (frameLineCount >= termCachedHeight) return 0;
+    for (int i = 0; i < frameLineCount; i++)
+    {
+        if (screenLineColumns(&frameLines[i]) >= termCachedWidth) return 0;
+    }
+    return 1;
+}
 
-    // Collect booking information for the logged-in user only
-    while (fgets(line, sizeof(line), file) && userBookingCount < 50)
+/**
+ * Roughly the bytes presentFrame would send to patch the shown rows into
+ * the frame, to weigh against a full repaint. Mirrors its diff loop.
+ */
+static long frameDiffCost()
+{
+    long cost = 0;
+    int cursorRow = shownLineCount - 1;
+    for (int i = 0; i < frameLineCount; i++)
     {
-        if (sscanf(line, "%d %[^\n]", &eventInLine, nameInLine) == 2)
+        if (i < shownLineCount)
         {
-            // Only store bookings for the current logged-in user
-            if (strcmp(nameInLine, loggedInUserName) == 0)
+            if (frameLines[i].len == shownLines[i].len && shownLinePrefixes(i)) continue;
+            if (cursorRow == i && shownLinePrefixes(i))
             {
-                strcpy(userBookings[userBookingCount], line);
-                userBookingCount++;
+                cost += frameLines[i].len - shownLines[i].len;
+                continue;
             }
+            cost += 4;  // Row erase
         }
+        // A newline when moving down one row, else a cursor move and likely a color switch
+        cost += (cursorRow == i - 1 && cursorRow >= 0) ? 1 : 12;
+        cost += frameLines[i].len;
+        cursorRow = i;
     }
-    fclose(file);
-    
-    if (userBookingCount == 0)
+    return cost;
+}
+
+// Bytes of a full repaint: clear the screen, then every row
+static long frameRepaintCost()
+{
+    long cost = 7 + frameLineCount;
+    for (int i = 0; i < frameLineCount; i++) cost += frameLines[i].len;
+    return cost;
+}
+
+/**
+ * Bring the terminal up to date with the frame in one write.
+ * Rows that match what is shown are skipped, text added to the row under
+ * the cursor is simply appended, other rows are erased whole and rewritten
+ * (a row may start with a column move, leaving old text to its left), and
+ * the cursor ends after the last row, where the next prompt expects it.
+ * When most rows change, a full repaint is cheaper and is sent instead.
+ * Like the rest of the UI it relies on '\n' also returning the carriage.
+ */
+static void presentFrame()
+{
+    if (termResized) termRefreshSize();
+    int rows = frameLineCount;
+    int fits = frameFitsScreen();
+    if (fits && shownValid && frameDiffCost() < frameRepaintCost())
     {
-        char buf[200];
-        snprintf(buf, sizeof(buf), "No bookings found for %s to cancel.", loggedInUserName);
-        printNotice(buf, 'I');
-        printNotice("Press any key to continue...", 'I');
-        getch();
-        return;
+        int cursorRow = shownLineCount - 1;  // The cursor sits at the end of this row
+        for (int i = 0; i < rows; i++)
+        {
+            if (i < shownLineCount)
+            {
+                if (frameLines[i].len == shownLines[i].len && shownLinePrefixes(i)) continue;
+                if (cursorRow == i && extendShownLine(i)) continue;
+            }
+            if (cursorRow == i - 1 && cursorRow >= 0) fputs("\n", stdout);
+            else printf("\x1b[%d;1H", i + 1);
+            if (i < shownLineCount) fputs("\x1b[2K", stdout);
+            emitScreenLine(i);
+            cursorRow = i;
+        }
+        if (cursorRow != rows - 1)
+            printf("\x1b[%d;%dH", rows, screenLineColumns(&frameLines[rows - 1]) + 1);
+        // Drop whatever the old frame had below the last row
+        if (shownLineCount > rows) fputs("\x1b[J", stdout);
     }
-    
-    // Build boxed list of user's bookings
-    const char *ptrs[60];
-    char items[60][300];
-    int count = 0;
-    for (int i = 0; i < userBookingCount && count < 60; i++)
+    else if (rows < termCachedHeight || presentedRow < 0)
     {
-        if (sscanf(userBookings[i], "%d %[^\n]", &eventInLine, nameInLine) == 2)
+        fputs("\x1b[H\x1b[2J", stdout);
+        for (int i = 0; i < rows; i++)
         {
-            char *eventName = getEventNameByID(eventInLine);
-            snprintf(items[count], sizeof(items[0]), "%d | %s", eventInLine, eventName);
-            ptrs[count] = items[count];
-            count++;
+            if (i > 0) fputs("\n", stdout);
+            emitScreenLine(i);
         }
     }
+    else
     {
-        char title[256];
-        snprintf(title, sizeof(title), "Your Current Bookings (%s)", loggedInUserName);
-        printMenuItemsWithBoxes(title, ptrs, count);
+        // Taller than the terminal: carry on from the cursor and let it scroll
+        if (!extendShownLine(presentedRow))
+        {
+            fputs("\r\x1b[2K", stdout);
+            emitScreenLine(presentedRow);
+        }
+        for (int i = presentedRow + 1; i < rows; i++)
+        {
+            fputs("\n", stdout);
+            emitScreenLine(i);
+        }
     }
+    if (shownColor != termColor) printf("\x1b[%sm", termSgr[termColor]);
+    shownColor = termColor;
+    fflush(stdout);
+    shownValid = fits;
+    snapshotFrame();
+}
 
-    // Now ask for the event ID to cancel
-    char buf[16];
-    inputUnified("Enter Event ID to cancel: ", buf, sizeof(buf));
-    if (sscanf(buf, "%d", &eventID) != 1)
+#ifndef _WIN32
+static void onTerminalResize(int sig)
+{
+    (void)sig;
+    termResized = 1;
+}
+#endif
+
+// Prepares the terminal once at startup: UTF-8 output, original colors, size
+void termInit()
+{
+#ifdef _WIN32
+    CONSOLE_SCREEN_BUFFER_INFO csbi;
+    DWORD mode;
+    termOutput = GetStdHandle(STD_OUTPUT_HANDLE);
+    SetConsoleOutputCP(CP_UTF8);
+    termOriginalAttrs = GetConsoleScreenBufferInfo(termOutput, &csbi)
+                      ? csbi.wAttributes : (FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE);
+    termInteractive = _isatty(_fileno(stdout));
+    // Pipes and files take escape sequences as they are; a console must opt in
+    termAnsi = !termInteractive
+            || (GetConsoleMode(termOutput, &mode) && SetConsoleMode(termOutput, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING));
+#else
+    termInteractive = isatty(STDOUT_FILENO);
+    struct sigaction resize;
+    memset(&resize, 0, sizeof(resize));
+    resize.sa_handler = onTerminalResize;
+    resize.sa_flags = SA_RESTART;  // A resize must not fail a pending read
+    sigemptyset(&resize.sa_mask);
+    sigaction(SIGWINCH, &resize, NULL);
+#endif
+    setvbuf(stdout, termFrame, _IOFBF, sizeof(termFrame));
+    termRefreshSize();
+#ifdef _WIN32
+    termRetained = termInteractive && termAnsi;
+    termEchoesInput = _isatty(_fileno(stdin));
+#else
+    termRetained = termInteractive;
+    termEchoesInput = isatty(STDIN_FILENO);
+#endif
+    startFrameLine();
+    atexit(termFlush);
+}
+
+// Writes the pending frame to the terminal in one go
+void termFlush()
+{
+    if (termRetained) presentFrame();
+    else fflush(stdout);
+}
+
+// Writes UI text ('\n' starts a row, '\b' steps back one character)
+void termWrite(const char *text)
+{
+    if (!termRetained)
     {
-        printNotice("Invalid input for Event ID.", 'W');
-        printNotice("Press any key to continue...", 'I');
-        getch();
+        fputs(text, stdout);
         return;
     }
-
-    // Use the logged-in user's name for cancellation
-    removeBooking(eventID, loggedInUserName);
-
-    // Add prompt to continue
-    char continueBuf[10];
-    inputUnifiedBlock("Press Enter to continue...", continueBuf, sizeof(continueBuf));
-    clear(); // Clear screen after cancellation process
+    while (*text)
+    {
+        ScreenLine *line = &frameLines[frameLineCount - 1];
+        const char *stop = text + strcspn(text, "\n\b");
+        appendScreenLine(line, text, (int)(stop - text));
+        text = stop;
+        if (*text == '\n')
+        {
+            startFrameLine();
+            text++;
+        }
+        else if (*text == '\b')
+        {
+            while (line->len > 0 && ((unsigned char)line->text[line->len - 1] & 0xC0) == 0x80) line->len--;
+            if (line->len > 0) line->len--;
+            text++;
+        }
+    }
 }
 
-void saveBooking(int eventID, const char *name)
+// printf-style termWrite
+void termPrintf(const char *fmt, ...)
 {
-    FILE *file = fopen(BOOKINGS_FILE, "a");
-    if (file == NULL)
+    char text[2048];
+    va_list args;
+    va_start(args, fmt);
+    int needed = vsnprintf(text, sizeof(text), fmt, args);
+    va_end(args);
+    if (needed < (int)sizeof(text))
     {
-        printNotice("Error opening file, Name of event ID not Found!", 'E');
+        termWrite(text);
         return;
     }
+    // Long table rows: format again into a buffer that fits
+    char *longText = malloc((size_t)needed + 1);
+    if (longText == NULL) return;
+    va_start(args, fmt);
+    vsnprintf(longText, (size_t)needed + 1, fmt, args);
+    va_end(args);
+    termWrite(longText);
+    free(longText);
+}
 
-    fprintf(file, "%d %s\n", eventID, name);
-    fclose(file);
+// Stdin is closed, so no menu can ever get a valid answer: leave instead of looping
+static void termEndOfInput()
+{
+    termSetColor(TERM_DEFAULT);
+    exit(0);
 }
 
-void removeBooking(int eventID, const char *name)
+/**
+ * Show the frame, then read one line of input into buffer without the
+ * trailing newline. The terminal echoes what is typed, so the screen
+ * model takes the line as already shown. Ends the program at end of input.
+ */
+void termReadLine(char *buffer, int size)
 {
-    FILE *file = fopen(BOOKINGS_FILE, "r");
-    FILE *tempFile = fopen("temp.txt", "w");
+    termFlush();
+    if (fgets(buffer, size, stdin) == NULL) termEndOfInput();
+    size_t len = strlen(buffer);
+    if (len > 0 && buffer[len - 1] == '\n') buffer[len - 1] = '\0';
+    if (!termRetained) return;
 
-    if (file == NULL || tempFile == NULL)
+    termWrite(buffer);
+    termWrite("\n");
+    if (termEchoesInput && presentedRow == frameLineCount - 2)
     {
-        printNotice("Error opening file!", 'E');
-        if (file)
-            fclose(file);
-        if (tempFile)
-            fclose(tempFile);
-        return;
+        int stillValid = shownValid && frameFitsScreen();
+        snapshotFrame();
+        shownValid = stillValid;
     }
+}
 
-    char line[200];
-    int eventInLine;
-    char nameInLine[100];
-    int found = 0;
-
-    while (fgets(line, sizeof(line), file))
+// Re-measures the terminal (falls back to $COLUMNS/$LINES, then 80x24)
+void termRefreshSize()
+{
+    int width = 0, height = 0;
+    termResized = 0;
+#ifdef _WIN32
+    CONSOLE_SCREEN_BUFFER_INFO csbi;
+    if (GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &csbi))
     {
-        if (sscanf(line, "%d %[^\n]", &eventInLine, nameInLine) == 2)
-        {
-            if (eventInLine == eventID && strcmp(nameInLine, name) == 0)
-            {
-                found = 1;
-                continue;
-            }
-        }
-        fputs(line, tempFile);
+        width = csbi.srWindow.Right - csbi.srWindow.Left + 1;
+        height = csbi.srWindow.Bottom - csbi.srWindow.Top + 1;
+    }
+#else
+    struct winsize ws;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &ws) == 0)
+    {
+        width = ws.ws_col;
+        height = ws.ws_row;
     }
+#endif
+    if (width <= 0 && getenv("COLUMNS") != NULL) width = atoi(getenv("COLUMNS"));
+    if (height <= 0 && getenv("LINES") != NULL) height = atoi(getenv("LINES"));
+    if (width != termCachedWidth || height != termCachedHeight) shownValid = 0;  // Rows may have reflowed
+    termCachedWidth = (width > 0) ? width : 80;
+    termCachedHeight = (height > 0) ? height : 24;
+}
 
-    fclose(file);
-    fclose(tempFile);
+// Cached terminal width in columns, re-measured only after a resize
+int termWidth()
+{
+    if (termResized) termRefreshSize();
+    return termCachedWidth;
+}
 
-    if (found)
+// Moves the cursor to a 0-based column of the current line
+void termMoveToColumn(int column)
+{
+#ifdef _WIN32
+    if (!termAnsi)
     {
-        remove(BOOKINGS_FILE);
-        rename("temp.txt", BOOKINGS_FILE);
-        printNotice("Booking successfully canceled.", 'S');
+        CONSOLE_SCREEN_BUFFER_INFO csbi;
+        termFlush();
+        if (!GetConsoleScreenBufferInfo(termOutput, &csbi)) return;
+        COORD pos = csbi.dwCursorPosition;
+        pos.X = (SHORT)column;
+        SetConsoleCursorPosition(termOutput, pos);
+        return;
     }
-    else
+#endif
+    if (termRetained)
     {
-        remove("temp.txt");
-        char buf[200];
-        snprintf(buf, sizeof(buf), "No booking found for %s at event ID %d.", name, eventID);
-        printNotice(buf, 'I');
+        // The move becomes part of the row, so it is replayed whenever the row is drawn
+        termPrintf("\x1b[%dG", column + 1);
+        return;
     }
+    printf("\r\x1b[%dG", column + 1);
 }
 
-/**
- * Remove all bookings associated with a given user name.
- * Returns the count of removed bookings.
- */
-int removeBookingsByUserName(const char *name)
+// Switches the text color for everything printed until termResetColor
+void termSetColor(int color)
 {
-    FILE *file = fopen(BOOKINGS_FILE, "r");
-    if (file == NULL)
+#ifdef _WIN32
+    if (!termAnsi)
     {
-        return 0; // No bookings file
+        static const WORD attrs[] = {
+            0,
+            FOREGROUND_GREEN | FOREGROUND_INTENSITY,
+            FOREGROUND_GREEN | FOREGROUND_BLUE | FOREGROUND_INTENSITY,
+            FOREGROUND_RED | FOREGROUND_INTENSITY,
+            FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_INTENSITY
+        };
+        termFlush();
+        SetConsoleTextAttribute(termOutput, (color == TERM_DEFAULT) ? termOriginalAttrs : attrs[color]);
+        return;
     }
-
-    FILE *temp = fopen("temp.txt", "w");
-    if (temp == NULL)
+#endif
+    termColor = color;
+    if (termRetained)
     {
-        fclose(file);
-        return 0;
+        termPrintf("\x1b[%sm", termSgr[color]);
+        return;
     }
+    printf("\x1b[%sm", termSgr[color]);
+}
 
-    char line[256];
-    int eventID;
-    char nameInLine[128];
-    int removed = 0;
+// Restores the colors the terminal had at startup
+void termResetColor()
+{
+    termSetColor(TERM_DEFAULT);
+}
 
-    while (fgets(line, sizeof(line), file))
+/**
+ * Read one key without echo and without waiting for Enter.
+ * Enter is returned as '\r' and Backspace as '\b' on every platform.
+ * When stdin is not a terminal, plain characters are read instead.
+ * Ends the program at end of input.
+ */
+int termGetKey()
+{
+    termFlush();
+#ifdef _WIN32
+    return _getch();
+#else
+    struct termios saved, raw;
+    int restore = tcgetattr(STDIN_FILENO, &saved) == 0;
+    if (restore)
     {
-        // Format written by saveBooking: "%d %s\n"; read name up to newline
-        if (sscanf(line, "%d %127[^\n]", &eventID, nameInLine) != 2)
-        {
-            continue;
-        }
-        // Compare exact name
-        if (strcmp(nameInLine, name) == 0)
-        {
-            removed++;
-            continue; // Skip writing -> remove
-        }
-        fputs(line, temp);
+        raw = saved;
+        raw.c_lflag &= ~(ICANON | ECHO);
+        raw.c_iflag &= ~ICRNL;
+        raw.c_cc[VMIN] = 1;
+        raw.c_cc[VTIME] = 0;
+        tcsetattr(STDIN_FILENO, TCSANOW, &raw);
     }
-
-    fclose(file);
-    fclose(temp);
-    remove(BOOKINGS_FILE);
-    rename("temp.txt", BOOKINGS_FILE);
-    return removed;
+    int ch = getchar();
+    if (restore) tcsetattr(STDIN_FILENO, TCSANOW, &saved);
+    if (ch == EOF) termEndOfInput();
+    if (ch == '\n') return '\r';
+    if (ch == 127) return '\b';
+    return ch;
+#endif
 }
 
-/*
- * ========================= MAIN FUNCTION =========================
- */
-int main()
+// Pauses for a UI animation; skipped when output is not a terminal, or when
+// the frame so far is already on screen (a dashboard redrawn over itself)
+void termSleep(int ms)
 {
-    system("chcp 65001");
-    srand((unsigned int)time(NULL));  // Initialize random seed for ticket generation
-    landingPage();
-    return 0;
+    if (!termInteractive) return;
+    if (termRetained && frameAlreadyShown()) return;
+    termFlush();
+#ifdef _WIN32
+    Sleep((DWORD)ms);
+#else
+    struct timespec delay = { ms / 1000, (ms % 1000) * 1000000L };
+    nanosleep(&delay, NULL);
+#endif
 }
 
 /*
  * ========================= UI & DESIGN HELPERS (definitions) =========================
  */
 
-// Clears the console screen for a fresh display
+// Clears the console screen for a fresh display; the clear goes out with the next frame
 void clear()
 {
-    system("cls");
+#ifdef _WIN32
+    if (!termAnsi)
+    {
+        CONSOLE_SCREEN_BUFFER_INFO csbi;
+        COORD home = { 0, 0 };
+        DWORD written;
+        termFlush();
+        if (GetConsoleScreenBufferInfo(termOutput, &csbi))
+        {
+            DWORD cells = (DWORD)csbi.dwSize.X * (DWORD)csbi.dwSize.Y;
+            FillConsoleOutputCharacterA(termOutput, ' ', cells, home, &written);
+            FillConsoleOutputAttribute(termOutput, csbi.wAttributes, cells, home, &written);
+            SetConsoleCursorPosition(termOutput, home);
+        }
+        termRefreshSize();
+        return;
+    }
+    termRefreshSize();
+#endif
+    if (termRetained)
+    {
+        // Start an empty frame; the next flush rewrites only rows that differ
+        frameLineCount = 0;
+        presentedRow = -1;
+        startFrameLine();
+        return;
+    }
+    printf("\x1b[H\x1b[2J\x1b[3J");
 }
 
 // Prints text centered on the console for professional appearance
 void printCentered(const char *str)
 {
-    if (!str) { printf("\n"); return; }
+    if (!str) { termWrite("\n"); return; }
     int width = getConsoleWidth();
     // Right-trim spaces and tabs to avoid skewing centering
     const char *end = str + strlen(str);
@@ -1875,8 +5272,7 @@ void printCentered(const char *str)
     int len = visualLen(buf);
     int pad = (width - len) / 2;
     if (pad < 0) pad = 0;
-    for (int i = 0; i < pad; i++) putchar(' ');
-    printf("%s\n", buf);
+    termPrintf("%*s%s\n", pad, "", buf);
 }
 
 // Displays the beautiful ASCII art welcome screen with application branding
@@ -1918,12 +5314,7 @@ void welcomePage()
         ""
     };
 
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-    WORD originalAttrs = csbi.wAttributes;
-
-    SetConsoleTextAttribute(hConsole, FOREGROUND_GREEN | FOREGROUND_INTENSITY);
+    termSetColor(TERM_GREEN);
 
     int lines = (int)(sizeof(art) / sizeof(art[0]));
     int width = getConsoleWidth();
@@ -1933,26 +5324,26 @@ void welcomePage()
         int doubled = vlen * 2;
         if (doubled > 0 && doubled <= width) {
             // Print with simple "bold" effect by doubling characters if it fits the screen
-            for (const char *p = line; *p; p++) {
-                putchar(*p); putchar(*p);
+            char bold[256];
+            int k = 0;
+            for (const char *p = line; *p && k < (int)sizeof(bold) - 2; p++) {
+                bold[k++] = *p; bold[k++] = *p;
             }
+            bold[k] = '\0';
+            termWrite(bold);
         } else {
             // Fallback: print once to avoid wrapping/"destroyed" art
-            fputs(line, stdout);
+            termWrite(line);
         }
-        putchar('\n');
+        termWrite("\n");
     }
 
-    SetConsoleTextAttribute(hConsole, originalAttrs);
+    termResetColor();
 }
 
 void dashboardDesign()
 {
-    HANDLE h = GetStdHandle(STD_OUTPUT_HANDLE);
-    CONSOLE_SCREEN_BUFFER_INFO ci;
-    GetConsoleScreenBufferInfo(h, &ci);
-
-    SetConsoleTextAttribute(h, FOREGROUND_GREEN | FOREGROUND_BLUE | FOREGROUND_INTENSITY);
+    termSetColor(TERM_CYAN);
 
     const char *art[] = {
         " _____           _____ _    _ ____   ____          _____  _____  ",
@@ -1967,20 +5358,16 @@ void dashboardDesign()
     for (int i = 0; i < lines; i++)
     {
         printCentered(art[i]);
-        Sleep(60);
+        termSleep(60);
     }
 
-    SetConsoleTextAttribute(h, ci.wAttributes);
+    termResetColor();
 }
 
 // Admin dashboard design with red color 
 void adminDashboardDesign()
 {
-    HANDLE h = GetStdHandle(STD_OUTPUT_HANDLE);
-    CONSOLE_SCREEN_BUFFER_INFO ci;
-    GetConsoleScreenBufferInfo(h, &ci);
-
-    SetConsoleTextAttribute(h, FOREGROUND_RED | FOREGROUND_INTENSITY);
+    termSetColor(TERM_RED);
 
     const char *ascii_art5 =
         "            _____  __  __ _____ _   _ \n"
@@ -2006,10 +5393,10 @@ void adminDashboardDesign()
         if (*ptr == '\n') ptr++; // Skip the newline
         
         printCentered(line);
-        Sleep(80);
+        termSleep(80);
     }
 
-    SetConsoleTextAttribute(h, ci.wAttributes);
+    termResetColor();
 }
 
 /*
@@ -2019,11 +5406,7 @@ void adminDashboardDesign()
 // Gets the width of the console window for proper alignment
 int getConsoleWidth()
 {
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-    if (GetConsoleScreenBufferInfo(hConsole, &csbi))
-        return csbi.srWindow.Right - csbi.srWindow.Left + 1;
-    return 80;
+    return termWidth();
 }
 
 // Calculates the center position for given content width
@@ -2040,9 +5423,7 @@ void printUnified(const char *str)
     int len = visualLen(str);
     int pad = calculateCenterPosition(len);
 
-    for (int i = 0; i < pad; i++)
-        putchar(' ');
-    printf("%s\n", str);
+    termPrintf("%*s%s\n", pad, "", str);
 }
 
 // Compact, centered notice box (double-line border) for one-off messages.
@@ -2051,13 +5432,13 @@ void printNotice(const char *msg, char type)
 {
     // Choose icon per type
     const char *icon = "";
-    WORD colorAttrs = 0;
+    int color = TERM_DEFAULT;
     switch (type)
     {
-    case 'S': icon = "\xE2\x9C\x94"; colorAttrs = FOREGROUND_GREEN | FOREGROUND_INTENSITY; break;      // ✓
-    case 'W': icon = "\xE2\x9A\xA0"; colorAttrs = FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_INTENSITY; break; // ⚠
-    case 'E': icon = "\xE2\x9C\x96"; colorAttrs = FOREGROUND_RED | FOREGROUND_INTENSITY; break;          // ✖
-    default:  icon = "\xE2\x84\xB9"; colorAttrs = FOREGROUND_BLUE | FOREGROUND_GREEN | FOREGROUND_INTENSITY; break; // ℹ
+    case 'S': icon = "\xE2\x9C\x94"; color = TERM_GREEN; break;  // ✓
+    case 'W': icon = "\xE2\x9A\xA0"; color = TERM_YELLOW; break; // ⚠
+    case 'E': icon = "\xE2\x9C\x96"; color = TERM_RED; break;    // ✖
+    default:  icon = "\xE2\x84\xB9"; color = TERM_CYAN; break;   // ℹ
     }
 
     char content[1024];
@@ -2087,10 +5468,7 @@ void printNotice(const char *msg, char type)
     snprintf(mid, sizeof(mid), "\xE2\x95\x91 %-*s \xE2\x95\x91", contentWidth, content); // ║ content ║
 
     // Colorize output
-    HANDLE h = GetStdHandle(STD_OUTPUT_HANDLE);
-    CONSOLE_SCREEN_BUFFER_INFO ci;
-    GetConsoleScreenBufferInfo(h, &ci);
-    SetConsoleTextAttribute(h, colorAttrs);
+    termSetColor(color);
 
     printUnified(top);
     printUnified(mid);
@@ -2098,7 +5476,7 @@ void printNotice(const char *msg, char type)
     printUnified("");
 
     // restore
-    SetConsoleTextAttribute(h, ci.wAttributes);
+    termResetColor();
 }
 
 // Draw a single centered box around a text. innerWidth controls the text area width (excluding borders)
@@ -2125,10 +5503,7 @@ void boxBordered(const char *text, int innerWidth)
 
     // Middle line: │ text │ (with one leading/trailing space inside)
     // Apply cyan color to generic boxes
-    HANDLE h = GetStdHandle(STD_OUTPUT_HANDLE);
-    CONSOLE_SCREEN_BUFFER_INFO ci;
-    GetConsoleScreenBufferInfo(h, &ci);
-    SetConsoleTextAttribute(h, FOREGROUND_GREEN | FOREGROUND_BLUE | FOREGROUND_INTENSITY);
+    termSetColor(TERM_CYAN);
 
     printUnified(top);
     // The formatted width should match the visual inner width minus 2 (for spaces)
@@ -2138,7 +5513,7 @@ void boxBordered(const char *text, int innerWidth)
     printUnified(bottom);
 
     // Restore original console attributes and add a blank line for spacing
-    SetConsoleTextAttribute(h, ci.wAttributes);
+    termResetColor();
     printUnified("");
 }
 
@@ -2178,28 +5553,15 @@ void printMenuItemsWithBoxes(const char *title, const char **items, int count)
 // Gets input using unified positioning for consistent UI
 void inputUnified(const char *prompt, char *buffer, int size)
 {
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-    
     int promptLen = visualLen(prompt);
     // Center based on the prompt text only for consistent alignment
     int pad = calculateCenterPosition(promptLen);
     
-    COORD pos = csbi.dwCursorPosition;
-    pos.X = pad;
-    SetConsoleCursorPosition(hConsole, pos);
-    
-    printf("%s", prompt);
-    fflush(stdout);
+    termMoveToColumn(pad);
     
-    pos.X += promptLen;
-    SetConsoleCursorPosition(hConsole, pos);
+    termWrite(prompt);
     
-    fgets(buffer, size, stdin);
-    size_t len = strlen(buffer);
-    if (len > 0 && buffer[len - 1] == '\n')
-        buffer[len - 1] = '\0';
+    termReadLine(buffer, size);
 }
 
 // Approximate visible length for UTF-8 strings; counts ASCII as 1, treats UTF-8 multi-byte sequences as width 1
@@ -2238,89 +5600,82 @@ int visualLen(const char *s)
     return count;
 }
 
-// Input function for block-aligned interface elements
-void inputUnifiedBlock(const char *prompt, char *buffer, int size)
+/*
+ * Unified blocks: detail screens and forms show their lines left-aligned in
+ * one column, centered on the widest line. A screen keeps its block as a
+ * local, adds each line once (formatted into the screen arena and measured
+ * as it is added), then prints the whole block in a single pass. Prompts
+ * asked below the block can reserve width so they fit in the same column.
+ */
+
+// Starts an empty block whose lines live in the screen's arena
+void blockInit(UnifiedBlock *block, Arena *arena)
+{
+    stringListInit(&block->lines, arena);
+    block->width = 0;
+    block->column = -1;
+}
+
+// Adds a line that outlives the block (a literal or arena text)
+void blockAdd(UnifiedBlock *block, const char *text)
 {
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-    
-    int promptLen = (int)strlen(prompt);
-    int pad = unified_blockStartPos;
-    
-    if (pad == -1) {
-        pad = calculateCenterPosition(promptLen + size);
-    }
-    
-    COORD pos = csbi.dwCursorPosition;
-    pos.X = pad;
-    SetConsoleCursorPosition(hConsole, pos);
-    
-    printf("%s", prompt);
-    fflush(stdout);
-    
-    pos.X += promptLen;
-    SetConsoleCursorPosition(hConsole, pos);
-    
-    fgets(buffer, size, stdin);
-    size_t len = strlen(buffer);
-    if (len > 0 && buffer[len - 1] == '\n')
-        buffer[len - 1] = '\0';
+    if (!stringListAdd(&block->lines, text)) return;
+    int len = visualLen(text);
+    if (len > block->width) block->width = len;
 }
 
-// Resets the unified block positioning system for new screens
-void resetUnifiedBlock()
+// printf-style blockAdd
+void blockAddf(UnifiedBlock *block, const char *fmt, ...)
 {
-    unified_blockMaxLen = 0;
-    unified_blockStartPos = -1;
-    unified_blockFirstCall = 1;
+    va_list args;
+    va_start(args, fmt);
+    char *text = arenaVStrf(block->lines.arena, fmt, args);
+    va_end(args);
+    if (text != NULL) blockAdd(block, text);
 }
 
-// Prints text left-aligned within unified blocks for consistent layout
-void printUnifiedBlockLeft(const char *str)
+// Widens the block for a prompt that will be asked at its column later
+void blockReserve(UnifiedBlock *block, const char *prompt)
 {
-    int currentLen = (int)strlen(str);
-    
-    if (unified_blockFirstCall) {
-        if (currentLen > unified_blockMaxLen) {
-            unified_blockMaxLen = currentLen;
-        }
-        return;
+    int len = visualLen(prompt);
+    if (len > block->width) block->width = len;
+}
+
+// Centers the block on its widest line and prints every line at that column
+void printUnifiedBlock(UnifiedBlock *block)
+{
+    block->column = calculateCenterPosition(block->width);
+    for (int i = 0; i < block->lines.count; i++)
+    {
+        termPrintf("%*s%s\n", block->column, "", block->lines.items[i]);
     }
+}
+
+// Input aligned with a printed block; without one the prompt and answer are centered together
+void inputUnifiedBlock(const UnifiedBlock *block, const char *prompt, char *buffer, int size)
+{
+    int pad = (block != NULL && block->column >= 0) ? block->column
+                                                    : calculateCenterPosition(visualLen(prompt) + size);
     
-    if (unified_blockStartPos == -1) {
-        unified_blockStartPos = calculateCenterPosition(unified_blockMaxLen);
-    }
+    termMoveToColumn(pad);
     
-    for (int i = 0; i < unified_blockStartPos; i++) {
-        putchar(' ');
-    }
+    termWrite(prompt);
     
-    printf("%s\n", str);
+    termReadLine(buffer, size);
 }
 
 // Password input using unified positioning with delayed character masking
 void inputPasswordUnified(char *buffer, int size)
 {
-    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-    CONSOLE_SCREEN_BUFFER_INFO csbi;
-    GetConsoleScreenBufferInfo(hConsole, &csbi);
-
     // Build prompt and center it similar to inputUnified
     const char *prompt = "Password: ";
     int promptLen = (int)strlen(prompt);
-    int pad = unified_blockStartPos;
-    if (pad == -1) {
-        // Center based on the prompt text only
-        pad = calculateCenterPosition(promptLen);
-    }
+    // Center based on the prompt text only
+    int pad = calculateCenterPosition(promptLen);
 
     // Position cursor
-    COORD pos = csbi.dwCursorPosition;
-    pos.X = pad;
-    SetConsoleCursorPosition(hConsole, pos);
-    printf("%s", prompt);
-    fflush(stdout);
+    termMoveToColumn(pad);
+    termWrite(prompt);
 
     // Read password character by character with hidden input
     int i = 0;
@@ -2329,7 +5684,7 @@ void inputPasswordUnified(char *buffer, int size)
     
     while (i < size - 1) // Leave space for null terminator
     {
-        ch = getch(); // Get character without echo
+        ch = termGetKey(); // Get character without echo
         
         if (ch == '\r' || ch == '\n') // Enter key
         {
@@ -2338,23 +5693,24 @@ void inputPasswordUnified(char *buffer, int size)
         else if (ch == '\b' && i > 0) // Backspace
         {
             i--;
-            printf("\b \b"); // Erase last asterisk
-            fflush(stdout);
+            termWrite("\b \b"); // Erase last asterisk
+            termFlush();
         }
         else if (ch != '\b') // Regular character
         {
+            char shown[2] = { ch, '\0' };
             buffer[i] = ch;
             i++;
-            printf("%c", ch); // Display actual character first
-            fflush(stdout);
-            Sleep(100); // Short preview for 75 ms
-            printf("\b*"); // Replace with asterisk
-            fflush(stdout);
+            termWrite(shown); // Display actual character first
+            termFlush();
+            termSleep(100); // Short preview for 75 ms
+            termWrite("\b*"); // Replace with asterisk
+            termFlush();
         }
     }
     
     buffer[i] = '\0'; // Null terminate
-    printf("\n"); // Move to next line
+    termWrite("\n"); // Move to next line
 }
 
 